@@ -0,0 +1,35 @@
+/*
+Allocation Counter
+By Ciaran Gruber
+
+Counts the allocations made by the program. The benchmarks are linked with '--wrap' for malloc,
+calloc and realloc so that every call to them within the library is passed through these functions
+
+File-specific:
+Allocation Counter - Code File
+The code used to count allocations
+*/
+
+#include <stddef.h>
+#include "bench.h"
+
+unsigned long bench_alloc_count = 0;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size) {
+    bench_alloc_count++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+    bench_alloc_count++;
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    bench_alloc_count++;
+    return __real_realloc(ptr, size);
+}
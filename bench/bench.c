@@ -0,0 +1,192 @@
+/*
+Benchmarks
+By Ciaran Gruber
+
+The benchmarks measure the time and the number of allocations taken by the hot paths of the
+library such as running functions
+
+File-specific:
+Benchmarks - Code File
+The code used to time each benchmark, report the results and create the programs being measured
+*/
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "bench.h"
+#include "../src/lang-package/package-info/pkg_dev_lang.h"
+
+/* The number of times each operation is run before it is measured */
+#define WARMUP_ITERATIONS 10000
+/* The number of batches each operation is measured in which are used to find the percentiles */
+#define BATCH_COUNT 200
+/* The number of times each operation is run in a batch */
+#define BATCH_SIZE 5000
+/* The number of error classes created by bench_new_program */
+#define ERROR_CLS_COUNT 5
+
+static int __compare_times(const void *first, const void *second);
+static double __percentile(double *sorted_times, int count, int percent);
+static inst_error_t *__noop(prog_hand_t *prog_handler, var_t *self, var_t *return_var,
+        var_t **params);
+
+int main(int argc, char **argv) {
+    // The scaling benchmarks print CSV so they are run separately to the core benchmarks
+    if (argc > 1 && strcmp(argv[1], "scaling") == 0) {
+        bench_scaling();
+        return 0;
+    }
+
+    // The benchmarks are only meaningful if the program does not leak or free memory twice
+    bench_memory();
+    printf("%-36s %10s %10s %10s %10s %10s\n", "benchmark", "ns/op", "p50", "p90", "p99",
+           "allocs/op");
+    bench_core();
+    return 0;
+}
+
+unsigned long long bench_now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000000ULL + (unsigned long long)now.tv_nsec;
+}
+
+void bench_measure(bench_op_t op, void *data, int batch_count, int batch_size,
+        bench_result_t *dest) {
+    double *batch_times = (double *)malloc(batch_count * sizeof(double));
+    if (batch_times == NULL) {
+        fprintf(stderr, "Failed to allocate the batch times\n");
+        exit(1);
+    }
+    unsigned long long total_ns = 0;
+    unsigned long allocs = 0;
+
+    int warmup = WARMUP_ITERATIONS < batch_count*batch_size ? WARMUP_ITERATIONS
+                                                             : batch_count*batch_size;
+    for (int i = 0; i < warmup; i++) {
+        op(data);
+    }
+
+    // Time each batch separately so that the spread of the times can be found
+    for (int batch = 0; batch < batch_count; batch++) {
+        unsigned long start_allocs = bench_alloc_count;
+        unsigned long long start = bench_now_ns();
+        for (int i = 0; i < batch_size; i++) {
+            op(data);
+        }
+        unsigned long long elapsed = bench_now_ns() - start;
+        allocs += bench_alloc_count - start_allocs;
+        total_ns += elapsed;
+        batch_times[batch] = (double)elapsed / batch_size;
+    }
+
+    long iterations = (long)batch_count * batch_size;
+    qsort(batch_times, batch_count, sizeof(double), __compare_times);
+    dest->ns_per_op = (double)total_ns / iterations;
+    dest->p50 = __percentile(batch_times, batch_count, 50);
+    dest->p90 = __percentile(batch_times, batch_count, 90);
+    dest->p99 = __percentile(batch_times, batch_count, 99);
+    dest->allocs_per_op = (double)allocs / iterations;
+    free(batch_times);
+}
+
+void bench_run(char *name, bench_op_t op, void *data) {
+    bench_result_t result;
+    bench_measure(op, data, BATCH_COUNT, BATCH_SIZE, &result);
+    printf("%-36s %10.1f %10.1f %10.1f %10.1f %10.3f\n", name, result.ns_per_op, result.p50,
+           result.p90, result.p99, result.allocs_per_op);
+}
+
+void bench_check(inst_error_t *error, char *action) {
+    if (error != NULL) {
+        fprintf(stderr, "Failed to %s\n", action);
+        exit(1);
+    }
+}
+
+void bench_expect(bool condition, char *action) {
+    if (!condition) {
+        fprintf(stderr, "Failed to %s\n", action);
+        exit(1);
+    }
+}
+
+prog_hand_t *bench_new_program(class_t **object_class) {
+    prog_hand_t *prog_handler = new_lang_package();
+
+    char *error_names[ERROR_CLS_COUNT] = { "ErrFunctionNotDefined", "ErrClassNotDefined",
+                                           "ErrVariableNotDefined", "ErrInvalidParameters",
+                                           "ErrOutOfMemory" };
+    bench_check(new_class(prog_handler, OBJECT_CLS_NAME, NULL, true, 0), "create Object");
+    bench_check(new_class(prog_handler, ERROR_CLS_NAME, OBJECT_CLS_NAME, true, 0),
+                "create Error");
+    for (int i = 0; i < ERROR_CLS_COUNT; i++) {
+        bench_check(new_class(prog_handler, error_names[i], ERROR_CLS_NAME, true, 0),
+                    "create an error class");
+    }
+
+    bench_check(get_class(prog_handler, object_class, OBJECT_CLS_NAME), "get Object");
+    bench_check(init_class(prog_handler, *object_class), "initialise Object");
+    // Running a function frees the data of the return variable
+    bench_add_noop(prog_handler, *object_class, "free_data", NULL, NULL, 0);
+    return prog_handler;
+}
+
+void bench_add_noop(prog_hand_t *prog_handler, class_t *class, char *name, class_t *return_type,
+        class_t **param_types, int param_count) {
+    function_t *function = (function_t *)malloc(sizeof(function_t));
+    if (function == NULL) {
+        fprintf(stderr, "Failed to allocate a function\n");
+        exit(1);
+    }
+    bench_check(new_function(prog_handler, function, name, __noop, return_type, param_types,
+                             param_count), "create a function");
+    bench_check(add_function(prog_handler, class, function), "add a function");
+}
+
+var_t *bench_new_var(prog_hand_t *prog_handler, char *type, char *name) {
+    var_t *var = (var_t *)malloc(sizeof(var_t));
+    if (var == NULL) {
+        fprintf(stderr, "Failed to allocate a variable\n");
+        exit(1);
+    }
+    bench_check(new_var(prog_handler, var), "create a variable");
+    bench_check(set_var_desc(prog_handler, var, type, name), "describe a variable");
+    bench_check(init_var(prog_handler, var, NULL, 0), "initialise a variable");
+    return var;
+}
+
+/*
+Compares two batch times so that they may be sorted from fastest to slowest
+*/
+static int __compare_times(const void *first, const void *second) {
+    double first_time = *(const double *)first;
+    double second_time = *(const double *)second;
+    return (first_time > second_time) - (first_time < second_time);
+}
+
+/*
+Gets a percentile of the batch times using the nearest rank
+
+*sorted_times: The batch times sorted from fastest to slowest
+count: The number of batch times
+percent: The percentile to get
+
+Returns: The batch time at the percentile
+*/
+static double __percentile(double *sorted_times, int count, int percent) {
+    int rank = (percent*count + 99) / 100;
+    if (rank < 1) rank = 1;
+    return sorted_times[rank - 1];
+}
+
+/*
+A Function that does nothing so that only the cost of running it is measured
+*/
+static inst_error_t *__noop(prog_hand_t *prog_handler, var_t *self, var_t *return_var,
+        var_t **params) {
+    return NULL;
+}
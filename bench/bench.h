@@ -0,0 +1,137 @@
+/*
+Benchmarks
+By Ciaran Gruber
+
+The benchmarks measure the time and the number of allocations taken by the hot paths of the
+library such as running functions
+
+File-specific:
+Benchmarks - Header File
+The structures and helpers shared by each of the benchmarks
+*/
+
+#ifndef BENCH
+#define BENCH
+
+#include "../src/lang-package/src/typedefs.h"
+
+/*
+An operation that is measured by a benchmark. The operation is run many times so it should leave
+the program in the same state that it found it
+
+*data: The data used by the operation
+*/
+typedef void (*bench_op_t)(void *data);
+
+/* The measurements taken for a single operation */
+typedef struct {
+    double ns_per_op;      // The average time taken by the operation in nanoseconds
+    double p50;            // The median time taken by a batch of the operation for each operation
+    double p90;            // The 90th percentile of the time taken for each operation
+    double p99;            // The 99th percentile of the time taken for each operation
+    double allocs_per_op;  // The average number of allocations made by the operation
+} bench_result_t;
+
+/* The number of allocations made by malloc, calloc and realloc since the program started */
+extern unsigned long bench_alloc_count;
+
+/*
+Gets the current time of a monotonic clock
+
+Returns: The current time in nanoseconds
+*/
+unsigned long long bench_now_ns(void);
+
+/*
+Measures an operation by running it in batches after warming it up
+
+op: The operation to measure
+*data: The data passed to the operation each time it is run
+batch_count: The number of batches to run, used to find the percentiles
+batch_size: The number of times the operation is run in each batch
+*dest: The location to store the measurements into
+*/
+void bench_measure(bench_op_t op, void *data, int batch_count, int batch_size,
+        bench_result_t *dest);
+
+/*
+Measures an operation by running it in batches and prints the average time taken, the percentiles
+of the time taken by each batch and the number of allocations made for each operation
+
+*name: The name of the benchmark
+op: The operation to measure
+*data: The data passed to the operation each time it is run
+*/
+void bench_run(char *name, bench_op_t op, void *data);
+
+/*
+Exits the benchmarks if an error has occurred
+
+*error: The error returned by the library
+*action: A description of what was being done when the error occurred
+*/
+void bench_check(inst_error_t *error, char *action);
+
+/*
+Exits the benchmarks if a check of the state of the library has failed
+
+condition: Whether the check passed
+*action: A description of what was being checked
+*/
+void bench_expect(bool condition, char *action);
+
+/*
+Creates a program handler containing only the Object class and the error classes thrown by the
+library so that no other classes affect the measurements. The Object class is initialised and has
+a 'free_data' Function that does nothing
+
+**object_class: The location to store the Object class into
+
+Returns: The created program handler
+*/
+prog_hand_t *bench_new_program(class_t **object_class);
+
+/*
+Adds a Function that does nothing to a class so that only the cost of running it is measured
+
+*prog_handler: The program handler that contains the class and error handlers
+*class: The class to add the Function to
+*name: The name of the Function
+*return_type: The class of the value returned by the Function
+**param_types: The classes of the parameters of the Function
+param_count: The number of parameters
+*/
+void bench_add_noop(prog_hand_t *prog_handler, class_t *class, char *name, class_t *return_type,
+        class_t **param_types, int param_count);
+
+/*
+Creates a variable with the given class and initialises it
+
+*prog_handler: The program handler that contains the class and error handlers
+*type: The name of the class of the variable
+*name: The name of the variable
+
+Returns: The created variable
+*/
+var_t *bench_new_var(prog_hand_t *prog_handler, char *type, char *name);
+
+/*
+Runs the checks that sharing, releasing, freeing and collecting variables leaves the Variable Pool
+with the same number of blocks in use, exiting if any check fails
+*/
+void bench_memory(void);
+
+/*
+Runs the benchmarks for the core object model which includes finding classes, creating variables,
+running functions, getting member fields and throwing errors
+*/
+void bench_core(void);
+
+/*
+Runs the scaling benchmarks which measure how running functions, creating variables and getting
+member fields slow down as the number of classes, the depth of inheritance and the number of
+overloads grows. The results are printed as CSV
+*/
+void bench_scaling(void);
+
+#endif
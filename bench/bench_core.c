@@ -0,0 +1,412 @@
+/*
+Core Benchmarks
+By Ciaran Gruber
+
+The core benchmarks measure the operations of the object model that are used by almost every
+program such as finding classes, creating variables and running functions
+
+File-specific:
+Core Benchmarks - Code File
+The code used to set up and run each of the core benchmarks
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "../src/lang-package/package-info/pkg_dev_lang.h"
+
+/* The name of the class whose functions are run by the benchmarks */
+#define BENCH_CLS_NAME "Bench"
+/* The name of the parent class of the Bench class */
+#define BASE_CLS_NAME "Base"
+/* The name of the class used for parameters */
+#define ARG_CLS_NAME "Arg"
+/* The name of the class whose instances hold an int as unmanaged data */
+#define SMALL_CLS_NAME "Small"
+/* The number of instances created together by the array benchmark */
+#define ARRAY_COUNT 16
+
+/* The classes and variables used by the core benchmarks */
+typedef struct {
+    prog_hand_t *prog_handler;  // The program handler containing the classes
+    class_t *bench_class;       // The class whose functions are run
+    cls_error_t *not_defined;   // The class of ErrFunctionNotDefined
+    var_t *self;                // An instance of the Bench class
+    var_t *params[2];           // Instances of the Arg class used as parameters
+    var_t *return_var;          // The variable that functions return to
+    var_t *imm_self;            // An immediate of the Small class
+    var_t *imm_params[1];       // An immediate of the Small class used as a parameter
+    int selector;               // The selector of the 'call' function
+    int field_slot;             // The slot of the member field 'field'
+    field_handle_t *handle;     // A Field Handle for 'base_field' resolved for the Base class
+    call_site_t *call_site;     // A Call Site for the 'call' function
+} core_data_t;
+
+static inst_error_t *__s_noop(prog_hand_t *prog_handler, var_t *return_var, var_t **params);
+static void __new_fixture(core_data_t *data);
+
+// Operations
+
+static void __get_class(void *data);
+static void __new_var(void *data);
+static void __new_pooled_var(void *data);
+static void __new_pooled_fields(void *data);
+static void __new_region_vars(void *data);
+static void __init_var_exact(void *data);
+static void __new_var_array(void *data);
+static void __gc_new_var(void *data);
+static void __run_own(void *data);
+static void __run_inherited(void *data);
+static void __run_overloaded(void *data);
+static void __run_immediate(void *data);
+static void __run_function_sel(void *data);
+static void __call_site_run(void *data);
+static void __run_s_function(void *data);
+static void __get_member_field(void *data);
+static void __get_member_field_slot(void *data);
+static void __get_member_field_h(void *data);
+static void __new_error_caught(void *data);
+static void __throw_error_caught(void *data);
+
+void bench_core(void) {
+    core_data_t data;
+    __new_fixture(&data);
+
+    bench_run("get_class", __get_class, &data);
+    bench_run("new_var + init_var + free_var", __new_var, &data);
+    bench_run("new_pooled_var + init_var + free_var", __new_pooled_var, &data);
+    bench_run("new_pooled_var + init_var (2 fields)", __new_pooled_fields, &data);
+    bench_run("region_begin + 4 vars + region_end", __new_region_vars, &data);
+    bench_run("new_pooled_var + init_var_exact (int)", __init_var_exact, &data);
+    bench_run("new_var_array (16) + free_var_array", __new_var_array, &data);
+    bench_run("gc_new_var + init_var (collected)", __gc_new_var, &data);
+    bench_run("run_function (own)", __run_own, &data);
+    bench_run("run_function (inherited)", __run_inherited, &data);
+    bench_run("run_function (overloaded)", __run_overloaded, &data);
+    bench_run("run_function (immediate)", __run_immediate, &data);
+    bench_run("run_function_sel", __run_function_sel, &data);
+    bench_run("call_site_run", __call_site_run, &data);
+    bench_run("run_s_function", __run_s_function, &data);
+    bench_run("get_member_field", __get_member_field, &data);
+    bench_run("get_member_field_slot", __get_member_field_slot, &data);
+    bench_run("get_member_field_h (inherited)", __get_member_field_h, &data);
+    // Uncaught errors exit the program so only caught errors can be measured
+    bench_run("new_error (caught)", __new_error_caught, &data);
+    bench_run("throw_error (caught)", __throw_error_caught, &data);
+
+    free_call_site(data.call_site);
+    free_field_handle(data.handle);
+    free_var(data.self);
+    free_var(data.params[0]);
+    free_var(data.params[1]);
+    free_var(data.return_var);
+    free_var(data.imm_self);
+    free_var(data.imm_params[0]);
+    free_lang_package(data.prog_handler);
+}
+
+/*
+Runs a Function on an immediate, which has no description, passing another immediate as a parameter
+*/
+static void __run_immediate(void *data) {
+    core_data_t *core = (core_data_t *)data;
+    bench_check(run_function(core->prog_handler, core->imm_self, "add", NULL, core->imm_params,
+                             1), "run add");
+}
+
+/*
+A Static Function that does nothing so that only the cost of running it is measured
+*/
+static inst_error_t *__s_noop(prog_hand_t *prog_handler, var_t *return_var, var_t **params) {
+    return NULL;
+}
+
+/*
+Creates a program handler containing the classes and functions used by the benchmarks. The Bench
+class inherits from the Base class and both have a member field. The Bench class has its own
+Function 'call', inherits the Function 'inherited' and has several overloads of the Function 'over'
+
+*data: The data to store the program handler, classes and variables in
+*/
+static void __new_fixture(core_data_t *data) {
+    class_t *object_class, *arg_class, *base_class, *bench_class, *small_class;
+    prog_hand_t *prog_handler = bench_new_program(&object_class);
+    data->prog_handler = prog_handler;
+
+    bench_check(new_class(prog_handler, ARG_CLS_NAME, OBJECT_CLS_NAME, true, 0), "create Arg");
+    bench_check(new_class(prog_handler, BASE_CLS_NAME, OBJECT_CLS_NAME, true, 0), "create Base");
+    bench_check(new_class(prog_handler, BENCH_CLS_NAME, BASE_CLS_NAME, true, 0), "create Bench");
+    bench_check(new_class(prog_handler, SMALL_CLS_NAME, OBJECT_CLS_NAME, false, sizeof(int)),
+                "create Small");
+
+    bench_check(get_class(prog_handler, &arg_class, ARG_CLS_NAME), "get Arg");
+    bench_check(get_class(prog_handler, &base_class, BASE_CLS_NAME), "get Base");
+    bench_check(get_class(prog_handler, &bench_class, BENCH_CLS_NAME), "get Bench");
+    bench_check(get_class(prog_handler, &small_class, SMALL_CLS_NAME), "get Small");
+    bench_check(get_class(prog_handler, &(data->not_defined), "ErrFunctionNotDefined"),
+                "get ErrFunctionNotDefined");
+    data->bench_class = bench_class;
+    class_t *classes[] = { arg_class, base_class, bench_class, small_class };
+    for (int i = 0; i < 4; i++) {
+        bench_check(init_class(prog_handler, classes[i]), "initialise a class");
+    }
+
+    class_t *object_param[] = { object_class };
+    class_t *arg_param[] = { arg_class };
+    class_t *base_param[] = { base_class };
+    class_t *two_args[] = { arg_class, arg_class };
+    class_t *base_arg[] = { base_class, arg_class };
+    bench_add_noop(prog_handler, bench_class, "call", object_class, object_param, 1);
+    bench_add_noop(prog_handler, base_class, "inherited", object_class, object_param, 1);
+    // Overloads are checked in the order they are added so the overload that is run is added last
+    bench_add_noop(prog_handler, bench_class, "over", object_class, base_arg, 2);
+    bench_add_noop(prog_handler, bench_class, "over", object_class, two_args, 2);
+    bench_add_noop(prog_handler, bench_class, "over", object_class, base_param, 1);
+    bench_add_noop(prog_handler, bench_class, "over", object_class, arg_param, 1);
+
+    // Instances of the Small class are used as immediate Integers
+    class_t *small_param[] = { small_class };
+    bench_check(set_imm_class(prog_handler, small_class, IMM_INTEGER), "tag Small");
+    bench_add_noop(prog_handler, small_class, "add", object_class, small_param, 1);
+
+    s_function_t *s_call = (s_function_t *)malloc(sizeof(s_function_t));
+    bench_check(new_s_function(prog_handler, s_call, "call", __s_noop, object_class,
+                               object_param, 1), "create static call");
+    bench_check(add_s_function(prog_handler, bench_class, s_call), "add static call");
+
+    bench_check(add_member_field(prog_handler, base_class, "base_field", arg_class),
+                "add base_field");
+    bench_check(add_member_field(prog_handler, bench_class, "field", arg_class), "add field");
+
+    bench_check(link_classes(prog_handler), "link classes");
+
+    // Variables
+    data->self = bench_new_var(prog_handler, BENCH_CLS_NAME, "self");
+    data->params[0] = bench_new_var(prog_handler, ARG_CLS_NAME, "first");
+    data->params[1] = bench_new_var(prog_handler, ARG_CLS_NAME, "second");
+    data->return_var = bench_new_var(prog_handler, OBJECT_CLS_NAME, "return_var");
+    int value = 42;
+    data->imm_self = (var_t *)malloc(sizeof(var_t));
+    data->imm_params[0] = (var_t *)malloc(sizeof(var_t));
+    bench_check(new_immediate(prog_handler, data->imm_self, IMM_INTEGER, &value),
+                "create an immediate");
+    bench_check(new_immediate(prog_handler, data->imm_params[0], IMM_INTEGER, &value),
+                "create an immediate");
+
+    bench_check(get_selector(prog_handler, &(data->selector), "call"), "get selector");
+    bench_check(get_field_slot(prog_handler, bench_class, &(data->field_slot), "field"),
+                "get field slot");
+    data->handle = (field_handle_t *)malloc(sizeof(field_handle_t));
+    bench_check(new_field_handle(prog_handler, data->handle, base_class, "base_field"),
+                "create field handle");
+    data->call_site = (call_site_t *)malloc(sizeof(call_site_t));
+    bench_check(new_call_site(prog_handler, data->call_site, "call", 1), "create call site");
+}
+
+/*
+Finds a class using its name
+*/
+static void __get_class(void *data) {
+    core_data_t *core = (core_data_t *)data;
+    class_t *class;
+    bench_check(get_class(core->prog_handler, &class, BENCH_CLS_NAME), "get Bench");
+}
+
+/*
+Creates, initialises and frees a variable
+*/
+static void __new_var(void *data) {
+    core_data_t *core = (core_data_t *)data;
+    var_t *var = (var_t *)malloc(sizeof(var_t));
+    bench_check(new_var(core->prog_handler, var), "create a variable");
+    bench_check(set_var_desc(core->prog_handler, var, ARG_CLS_NAME, "var"), "describe a variable");
+    bench_check(init_var(core->prog_handler, var, NULL, 0), "initialise a variable");
+    free_var(var);
+}
+
+/*
+Creates, initialises and frees a variable allocated from the Variable Pool
+*/
+static void __new_pooled_var(void *data) {
+    core_data_t *core = (core_data_t *)data;
+    var_t *var;
+    bench_check(new_pooled_var(core->prog_handler, &var), "create a variable");
+    bench_check(set_var_desc(core->prog_handler, var, ARG_CLS_NAME, "var"), "describe a variable");
+    bench_check(init_var(core->prog_handler, var, NULL, 0), "initialise a variable");
+    free_var(var);
+}
+
+/*
+Creates, initialises and frees an instance of the Bench class, whose member fields are copied from
+the prototype of the class
+*/
+static void __new_pooled_fields(void *data) {
+    core_data_t *core = (core_data_t *)data;
+    var_t *var;
+    bench_check(new_pooled_var(core->prog_handler, &var), "create a variable");
+    bench_check(set_var_desc(core->prog_handler, var, BENCH_CLS_NAME, "var"),
+                "describe a variable");
+    bench_check(init_var(core->prog_handler, var, NULL, 0), "initialise a variable");
+    free_var(var);
+}
+
+/*
+Creates, describes and initialises four variables within a region that discards them together
+without freeing each one
+*/
+static void __new_region_vars(void *data) {
+    core_data_t *core = (core_data_t *)data;
+    bench_check(region_begin(core->prog_handler), "begin a region");
+    for (int i = 0; i < 4; i++) {
+        var_t *var;
+        bench_check(new_pooled_var(core->prog_handler, &var), "create a variable");
+        bench_check(set_var_desc(core->prog_handler, var, ARG_CLS_NAME, "var"),
+                    "describe a variable");
+        bench_check(init_var(core->prog_handler, var, NULL, 0), "initialise a variable");
+    }
+    bench_check(region_end(core->prog_handler), "end a region");
+}
+
+/*
+Creates a variable holding an int as unmanaged data, which is small enough to be stored within the
+variable itself, and frees it
+*/
+static void __init_var_exact(void *data) {
+    core_data_t *core = (core_data_t *)data;
+    var_t *var;
+    int value = 42;
+    bench_check(new_pooled_var(core->prog_handler, &var), "create a variable");
+    bench_check(set_var_desc(core->prog_handler, var, SMALL_CLS_NAME, "var"), "describe a variable");
+    bench_check(init_var_exact(core->prog_handler, var, &value), "initialise a variable");
+    free_var(var);
+}
+
+/*
+Creates and frees the instances of the Bench class, each with two member fields, in a single array
+*/
+static void __new_var_array(void *data) {
+    core_data_t *core = (core_data_t *)data;
+    var_array_t *array;
+    bench_check(new_var_array(core->prog_handler, &array, core->bench_class, "var", ARRAY_COUNT,
+                              NULL, 0), "create an array");
+    free_var_array(array);
+}
+
+/*
+Creates and initialises a variable tracked by the collector without freeing it. The variable is
+unreachable so it is freed by the sweep of a later collection
+*/
+static void __gc_new_var(void *data) {
+    core_data_t *core = (core_data_t *)data;
+    var_t *var;
+    bench_check(gc_new_var(core->prog_handler, &var), "create a variable");
+    bench_check(set_var_desc(core->prog_handler, var, ARG_CLS_NAME, "var"), "describe a variable");
+    bench_check(init_var(core->prog_handler, var, NULL, 0), "initialise a variable");
+}
+
+/*
+Runs a Function defined by the class of the variable
+*/
+static void __run_own(void *data) {
+    core_data_t *core = (core_data_t *)data;
+    bench_check(run_function(core->prog_handler, core->self, "call", core->return_var,
+                             core->params, 1), "run call");
+}
+
+/*
+Runs a Function inherited from the parent class of the variable
+*/
+static void __run_inherited(void *data) {
+    core_data_t *core = (core_data_t *)data;
+    bench_check(run_function(core->prog_handler, core->self, "inherited", core->return_var,
+                             core->params, 1), "run inherited");
+}
+
+/*
+Runs one of several overloads of a Function
+*/
+static void __run_overloaded(void *data) {
+    core_data_t *core = (core_data_t *)data;
+    bench_check(run_function(core->prog_handler, core->self, "over", core->return_var,
+                             core->params, 1), "run over");
+}
+
+/*
+Runs a Function using a stored selector rather than its name
+*/
+static void __run_function_sel(void *data) {
+    core_data_t *core = (core_data_t *)data;
+    bench_check(run_function_sel(core->prog_handler, core->self, core->selector,
+                                 core->return_var, core->params, 1), "run call by selector");
+}
+
+/*
+Runs a Function using a Call Site that has cached the Function
+*/
+static void __call_site_run(void *data) {
+    core_data_t *core = (core_data_t *)data;
+    bench_check(call_site_run(core->prog_handler, core->call_site, core->self, core->return_var,
+                              core->params), "run call site");
+}
+
+/*
+Runs a Static Function
+*/
+static void __run_s_function(void *data) {
+    core_data_t *core = (core_data_t *)data;
+    bench_check(run_s_function(core->prog_handler, core->bench_class, "call", core->return_var,
+                               core->params, 1), "run static call");
+}
+
+/*
+Gets a member field of a variable
+*/
+static void __get_member_field(void *data) {
+    core_data_t *core = (core_data_t *)data;
+    var_t *field;
+    bench_check(get_member_field(core->prog_handler, core->self, &field, "field"), "get field");
+}
+
+/*
+Gets a member field of a variable using its slot
+*/
+static void __get_member_field_slot(void *data) {
+    core_data_t *core = (core_data_t *)data;
+    var_t *field;
+    bench_check(get_member_field_slot(core->prog_handler, core->self, &field, core->field_slot),
+                "get field by slot");
+}
+
+/*
+Gets an inherited member field of a variable using a Field Handle resolved for the parent class
+*/
+static void __get_member_field_h(void *data) {
+    core_data_t *core = (core_data_t *)data;
+    var_t *field;
+    bench_check(get_member_field_h(core->prog_handler, core->self, &field, core->handle),
+                "get field by handle");
+}
+
+/*
+Throws an error using its name after marking it to be caught
+*/
+static void __new_error_caught(void *data) {
+    core_data_t *core = (core_data_t *)data;
+    bench_check(add_err(core->prog_handler, "ErrFunctionNotDefined"), "catch error");
+    inst_error_t *error = new_error(core->prog_handler, "ErrFunctionNotDefined");
+    if (!err_is_class(error, core->not_defined)) {
+        bench_check(error, "catch ErrFunctionNotDefined");
+    }
+}
+
+/*
+Throws an error using its class after marking it to be caught
+*/
+static void __throw_error_caught(void *data) {
+    core_data_t *core = (core_data_t *)data;
+    bench_check(add_err_cls(core->prog_handler, core->not_defined), "catch error");
+    inst_error_t *error = throw_error(core->prog_handler, core->not_defined);
+    if (!err_is_class(error, core->not_defined)) {
+        bench_check(error, "catch ErrFunctionNotDefined");
+    }
+}
@@ -0,0 +1,188 @@
+/*
+Memory Checks
+By Ciaran Gruber
+
+The memory checks make sure that the ways of sharing and freeing variables leave the Variable Pool
+as they found it, so that the benchmarks do not measure a program that leaks or frees memory twice
+
+File-specific:
+Memory Checks - Code File
+The code used to set up and run each of the memory checks
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "../src/lang-package/package-info/pkg_dev_lang.h"
+
+/* The name of the class whose instances are shared by the checks */
+#define SHARED_CLS_NAME "Shared"
+/* The name of the class whose instances hold a Shared instance as a member field */
+#define HOLDER_CLS_NAME "Holder"
+/* The number of instances created together by the array check */
+#define ARRAY_COUNT 4
+/* The number of unreachable variables created by the collector check to begin collections */
+#define CHURN_COUNT 2000
+
+static long __live_blocks(prog_hand_t *prog_handler);
+static void __check_shared_var(prog_hand_t *prog_handler, class_t *shared_class);
+static void __check_member_field(prog_hand_t *prog_handler, class_t *holder_class);
+static void __check_array_var(prog_hand_t *prog_handler, class_t *holder_class);
+static void __check_collector(prog_hand_t *prog_handler, class_t *shared_class);
+static var_t *__gc_new_shared(prog_hand_t *prog_handler, char *name);
+
+void bench_memory(void) {
+    class_t *object_class, *shared_class, *holder_class;
+    prog_hand_t *prog_handler = bench_new_program(&object_class);
+
+    bench_check(new_class(prog_handler, SHARED_CLS_NAME, OBJECT_CLS_NAME, true, 0),
+                "create Shared");
+    bench_check(new_class(prog_handler, HOLDER_CLS_NAME, OBJECT_CLS_NAME, true, 0),
+                "create Holder");
+    bench_check(get_class(prog_handler, &shared_class, SHARED_CLS_NAME), "get Shared");
+    bench_check(get_class(prog_handler, &holder_class, HOLDER_CLS_NAME), "get Holder");
+    bench_check(init_class(prog_handler, shared_class), "initialise Shared");
+    bench_check(init_class(prog_handler, holder_class), "initialise Holder");
+    bench_check(add_member_field(prog_handler, holder_class, "field", shared_class),
+                "add field");
+    bench_check(link_classes(prog_handler), "link classes");
+    // The prototype of the Holder class is kept with the class once it is built so it is built
+    // before the checks count the blocks in use
+    free_var(bench_new_var(prog_handler, HOLDER_CLS_NAME, "holder"));
+
+    __check_shared_var(prog_handler, shared_class);
+    __check_member_field(prog_handler, holder_class);
+    __check_array_var(prog_handler, holder_class);
+    __check_collector(prog_handler, shared_class);
+
+    free_lang_package(prog_handler);
+    printf("memory checks passed\n");
+}
+
+/*
+Gets the number of blocks of the Variable Pool that are in use
+*/
+static long __live_blocks(prog_hand_t *prog_handler) {
+    long live_blocks, free_blocks;
+    size_t slab_bytes;
+    bench_check(get_pool_stats(prog_handler, &live_blocks, &free_blocks, &slab_bytes),
+                "get pool stats");
+    return live_blocks;
+}
+
+/*
+Shares a variable with a class by adding it as a class variable. The variable must outlive its
+removal from the class and be freed by the last release
+*/
+static void __check_shared_var(prog_hand_t *prog_handler, class_t *shared_class) {
+    long live_blocks = __live_blocks(prog_handler);
+    var_t *var;
+    bench_check(new_pooled_var(prog_handler, &var), "create a variable");
+    bench_check(set_var_desc(prog_handler, var, SHARED_CLS_NAME, "shared"),
+                "describe a variable");
+    bench_check(init_var(prog_handler, var, NULL, 0), "initialise a variable");
+
+    // The class takes over the reference given to it so another is kept for after the removal
+    retain_var(var);
+    bench_check(add_class_var(prog_handler, shared_class, var), "add a class variable");
+    bench_check(remove_class_var(prog_handler, shared_class, "shared"),
+                "remove a class variable");
+    bench_expect(var->initialised, "keep a shared variable after its removal");
+
+    retain_var_atomic(var);
+    release_var_atomic(var);
+    release_var(var);
+    bench_expect(__live_blocks(prog_handler) == live_blocks,
+                 "free a variable on its last release");
+}
+
+/*
+Shares a member field with a class. Member fields are stored within their instance so neither
+releasing nor freeing them may free their memory, which is freed with the instance
+*/
+static void __check_member_field(prog_hand_t *prog_handler, class_t *holder_class) {
+    long live_blocks = __live_blocks(prog_handler);
+    var_t *holder, *field;
+    bench_check(new_pooled_var(prog_handler, &holder), "create a variable");
+    bench_check(set_var_desc(prog_handler, holder, HOLDER_CLS_NAME, "holder"),
+                "describe a variable");
+    bench_check(init_var(prog_handler, holder, NULL, 0), "initialise a variable");
+    bench_check(get_member_field(prog_handler, holder, &field, "field"), "get a member field");
+
+    retain_var(field);
+    bench_check(add_class_var(prog_handler, holder_class, field), "add a class variable");
+    bench_check(remove_class_var(prog_handler, holder_class, "field"),
+                "remove a class variable");
+    release_var(field);
+    release_var_atomic(field);
+    bench_expect(field->initialised, "keep a member field after its last release");
+
+    free_var(holder);
+    bench_expect(__live_blocks(prog_handler) == live_blocks,
+                 "free a member field with its holder");
+}
+
+/*
+Releases and frees an instance within an array, which must leave the instance in place for
+free_var_array to free
+*/
+static void __check_array_var(prog_hand_t *prog_handler, class_t *holder_class) {
+    long live_blocks = __live_blocks(prog_handler);
+    var_array_t *array;
+    var_t *var;
+    bench_check(new_var_array(prog_handler, &array, holder_class, "holder", ARRAY_COUNT, NULL,
+                              0), "create an array");
+    bench_check(get_array_var(prog_handler, array, &var, 1), "get an array instance");
+    release_var(var);
+    bench_expect(var->initialised, "keep an array instance after its last release");
+    free_var(var);
+    bench_expect(!var->initialised, "free the data of an array instance");
+
+    free_var_array(array);
+    bench_expect(__live_blocks(prog_handler) == live_blocks, "free an array");
+}
+
+/*
+Creates variables tracked by the collector. A rooted and a pushed variable must survive both a whole
+collection and the batched sweeps begun by creating variables, while the rest must be freed
+*/
+static void __check_collector(prog_hand_t *prog_handler, class_t *shared_class) {
+    long live_blocks = __live_blocks(prog_handler);
+    var_t *rooted = __gc_new_shared(prog_handler, "rooted");
+    var_t *pushed = __gc_new_shared(prog_handler, "pushed");
+    bench_check(gc_add_root(prog_handler, rooted), "add a root");
+    bench_check(gc_push(prog_handler, pushed), "push a variable");
+    long kept_blocks = __live_blocks(prog_handler);
+
+    // The collector frees tracked variables so a class must not hold one
+    bench_check(add_err(prog_handler, "ErrInvalidParameters"), "catch ErrInvalidParameters");
+    bench_expect(add_class_var(prog_handler, shared_class, rooted) != NULL,
+                 "reject a tracked class variable");
+
+    __gc_new_shared(prog_handler, "unrooted");
+    bench_check(gc_collect(prog_handler), "collect");
+    bench_expect(__live_blocks(prog_handler) == kept_blocks, "collect an unrooted variable");
+
+    for (int i = 0; i < CHURN_COUNT; i++) {
+        __gc_new_shared(prog_handler, "unrooted");
+    }
+    bench_expect(rooted->initialised && pushed->initialised, "keep variables during a sweep");
+    bench_check(gc_collect(prog_handler), "collect");
+    bench_expect(__live_blocks(prog_handler) == kept_blocks, "collect after batched sweeps");
+
+    bench_check(gc_pop(prog_handler, 1), "pop a variable");
+    bench_check(gc_remove_root(prog_handler, rooted), "remove a root");
+    bench_check(gc_collect(prog_handler), "collect");
+    bench_expect(__live_blocks(prog_handler) == live_blocks, "collect unrooted variables");
+}
+
+/*
+Creates and initialises an instance of the Shared class that is tracked by the collector
+*/
+static var_t *__gc_new_shared(prog_hand_t *prog_handler, char *name) {
+    var_t *var;
+    bench_check(gc_new_var(prog_handler, &var), "create a tracked variable");
+    bench_check(set_var_desc(prog_handler, var, SHARED_CLS_NAME, name), "describe a variable");
+    bench_check(init_var(prog_handler, var, NULL, 0), "initialise a variable");
+    return var;
+}
\ No newline at end of file
@@ -0,0 +1,340 @@
+/*
+Scaling Benchmarks
+By Ciaran Gruber
+
+The scaling benchmarks generate programs with many classes, deep inheritance chains and many
+overloads of a function to measure how the handlers within the library slow down as a program grows
+
+File-specific:
+Scaling Benchmarks - Code File
+The code used to generate each workload, measure it and print the results as CSV
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "../src/lang-package/package-info/pkg_dev_lang.h"
+#include "../src/lang-package/src/program-handlers/method-cache/method_cache.h"
+
+/* The number of batches each operation is measured in - Fewer than the core benchmarks */
+#define SCALING_BATCH_COUNT 50
+/* The number of times each operation is run in a batch */
+#define SCALING_BATCH_SIZE 1000
+/* The number of times a whole workload is generated when measuring the time taken to import it */
+#define IMPORT_BATCH_COUNT 5
+/* The longest name given to a generated class or member field */
+#define MAX_GEN_NAME_LEN 32
+/* The number of classes used while the depth or number of overloads is changed */
+#define DEFAULT_CLASS_COUNT 256
+/* The depth of inheritance used while the number of classes or overloads is changed */
+#define DEFAULT_DEPTH 8
+/* The number of overloads used while the number of classes or depth is changed */
+#define DEFAULT_OVERLOADS 8
+
+/*
+The classes and variables of a generated program. The program contains 'class_count' classes split
+into chains where each class inherits from the one before it, 'depth' classes long. Each class adds
+a member field and the first class of each chain has 'overloads' overloads of the Function 'method'
+*/
+typedef struct {
+    prog_hand_t *prog_handler;    // The program handler containing the generated classes
+    int class_count;              // The number of generated classes
+    int depth;                    // The number of classes in each chain
+    int overloads;                // The number of overloads of 'method'
+    char (*class_names)[MAX_GEN_NAME_LEN]; // The names of every generated class
+    var_t **leaves;               // An instance of the last class of each chain
+    int leaf_count;               // The number of chains
+    int next_class;               // The next class name used by the get_class operation
+    int next_leaf;                // The next instance used by the warm dispatch operation
+    char leaf_field[MAX_GEN_NAME_LEN]; // The name of the member field added by the last class
+    int leaf_slot;                // The slot of the member field added by the last class
+    field_handle_t *root_handle;  // A Field Handle for the member field of the first class
+    var_t *params[1];             // The parameter passed to 'method'
+    var_t *return_var;            // The variable that functions return to
+} workload_t;
+
+static void __sweep(char *sweep, int class_count, int depth, int overloads);
+static void __new_workload(workload_t *dest, int class_count, int depth, int overloads);
+static void __free_workload(workload_t *src);
+static void __print_row(char *sweep, workload_t *workload, char *operation, bench_op_t op);
+static void __print_import_row(char *sweep, workload_t *workload);
+
+// Operations
+
+static void __import(void *data);
+static void __get_class(void *data);
+static void __run_warm(void *data);
+static void __run_cold(void *data);
+static void __new_var(void *data);
+static void __get_member_field(void *data);
+static void __get_member_field_slot(void *data);
+static void __get_member_field_h(void *data);
+
+void bench_scaling(void) {
+    printf("sweep,classes,depth,overloads,operation,ns_per_op,p50,p90,p99,allocs_per_op\n");
+
+    // Change one dimension at a time so each can be plotted on its own
+    int class_counts[] = { 64, 256, 1024, 4096, 16384 };
+    for (int i = 0; i < 5; i++) {
+        __sweep("classes", class_counts[i], DEFAULT_DEPTH, DEFAULT_OVERLOADS);
+    }
+    int depths[] = { 1, 2, 4, 8, 16, 32, 64 };
+    for (int i = 0; i < 7; i++) {
+        __sweep("depth", DEFAULT_CLASS_COUNT, depths[i], DEFAULT_OVERLOADS);
+    }
+    int overloads[] = { 1, 2, 4, 8, 16, 32, 64 };
+    for (int i = 0; i < 7; i++) {
+        __sweep("overloads", DEFAULT_CLASS_COUNT, DEFAULT_DEPTH, overloads[i]);
+    }
+}
+
+/*
+Generates a workload, measures each operation for it and frees it
+
+*sweep: The name of the dimension that is being changed
+class_count: The number of classes to generate
+depth: The number of classes in each inheritance chain - Must divide 'class_count'
+overloads: The number of overloads of 'method'
+*/
+static void __sweep(char *sweep, int class_count, int depth, int overloads) {
+    workload_t workload;
+    __new_workload(&workload, class_count, depth, overloads);
+
+    __print_row(sweep, &workload, "get_class", __get_class);
+    __print_row(sweep, &workload, "run_function (warm)", __run_warm);
+    __print_row(sweep, &workload, "run_function (cold)", __run_cold);
+    __print_row(sweep, &workload, "new_var + init_var + free_var", __new_var);
+    __print_row(sweep, &workload, "get_member_field", __get_member_field);
+    __print_row(sweep, &workload, "get_member_field_slot", __get_member_field_slot);
+    __print_row(sweep, &workload, "get_member_field_h", __get_member_field_h);
+    __print_import_row(sweep, &workload);
+
+    __free_workload(&workload);
+}
+
+/*
+Generates a program with the given number of classes, depth of inheritance and overloads
+
+*dest: The workload to store the program and its variables into
+class_count: The number of classes to generate
+depth: The number of classes in each inheritance chain - Must divide 'class_count'
+overloads: The number of overloads of 'method'
+*/
+static void __new_workload(workload_t *dest, int class_count, int depth, int overloads) {
+    class_t *object_class;
+    prog_hand_t *prog_handler = bench_new_program(&object_class);
+    char name[MAX_GEN_NAME_LEN];
+
+    dest->prog_handler = prog_handler;
+    dest->class_count = class_count;
+    dest->depth = depth;
+    dest->overloads = overloads;
+    dest->leaf_count = class_count / depth;
+    dest->next_class = 0;
+    dest->next_leaf = 0;
+    sprintf(dest->leaf_field, "field%05d", depth - 1);
+    dest->class_names = malloc(class_count * sizeof(*(dest->class_names)));
+    dest->leaves = (var_t **)malloc(dest->leaf_count * sizeof(var_t *));
+    class_t **param_classes = (class_t **)malloc(overloads * sizeof(class_t *));
+    if (dest->class_names == NULL || dest->leaves == NULL || param_classes == NULL) {
+        fprintf(stderr, "Failed to allocate a workload\n");
+        exit(1);
+    }
+
+    // Create a parameter class for each overload so that no overload hides another
+    for (int i = 0; i < overloads; i++) {
+        sprintf(name, "Param%d", i);
+        bench_check(new_class(prog_handler, name, OBJECT_CLS_NAME, true, 0), "create a Param");
+        bench_check(get_class(prog_handler, &(param_classes[i]), name), "get a Param");
+        bench_check(init_class(prog_handler, param_classes[i]), "initialise a Param");
+    }
+
+    for (int i = 0; i < class_count; i++) {
+        int level = i % depth;
+        class_t *class;
+        sprintf(dest->class_names[i], "Class%d", i);
+        char *parent = level == 0 ? OBJECT_CLS_NAME : dest->class_names[i - 1];
+        bench_check(new_class(prog_handler, dest->class_names[i], parent, true, 0),
+                    "create a class");
+        bench_check(get_class(prog_handler, &class, dest->class_names[i]), "get a class");
+        bench_check(init_class(prog_handler, class), "initialise a class");
+
+        // Member fields are kept sorted by name so the field of the last class is found last
+        sprintf(name, "field%05d", level);
+        bench_check(add_member_field(prog_handler, class, name, param_classes[0]),
+                    "add a member field");
+
+        // Overloads are checked in the order they are added so the overload that is run is last
+        if (level == 0) {
+            for (int j = overloads - 1; j >= 0; j--) {
+                bench_add_noop(prog_handler, class, "method", object_class, &(param_classes[j]),
+                               1);
+            }
+        }
+    }
+    bench_check(link_classes(prog_handler), "link classes");
+    free(param_classes);
+
+    for (int i = 0; i < dest->leaf_count; i++) {
+        dest->leaves[i] = bench_new_var(prog_handler, dest->class_names[i*depth + depth - 1],
+                                        "leaf");
+    }
+    dest->params[0] = bench_new_var(prog_handler, "Param0", "param");
+    class_t *leaf_class;
+    bench_check(get_class(prog_handler, &leaf_class, dest->class_names[depth - 1]), "get a leaf");
+    bench_check(get_field_slot(prog_handler, leaf_class, &(dest->leaf_slot), dest->leaf_field),
+                "get a field slot");
+    // The handle is resolved for the first class of the chain and used on the last class
+    class_t *root_class;
+    bench_check(get_class(prog_handler, &root_class, dest->class_names[0]), "get a root");
+    dest->root_handle = (field_handle_t *)malloc(sizeof(field_handle_t));
+    if (dest->root_handle == NULL) {
+        fprintf(stderr, "Failed to allocate a field handle\n");
+        exit(1);
+    }
+    bench_check(new_field_handle(prog_handler, dest->root_handle, root_class, "field00000"),
+                "create a field handle");
+    dest->return_var = bench_new_var(prog_handler, OBJECT_CLS_NAME, "return_var");
+}
+
+/*
+Frees the program and variables of a workload
+
+*src: The workload to free
+*/
+static void __free_workload(workload_t *src) {
+    for (int i = 0; i < src->leaf_count; i++) {
+        free_var(src->leaves[i]);
+    }
+    free_var(src->params[0]);
+    free_var(src->return_var);
+    free_field_handle(src->root_handle);
+    free(src->leaves);
+    free(src->class_names);
+    free_lang_package(src->prog_handler);
+}
+
+/*
+Measures an operation for a workload and prints the results as a row of CSV
+
+*sweep: The name of the dimension that is being changed
+*workload: The workload to measure the operation for
+*operation: The name of the operation
+op: The operation to measure
+*/
+static void __print_row(char *sweep, workload_t *workload, char *operation, bench_op_t op) {
+    bench_result_t result;
+    bench_measure(op, workload, SCALING_BATCH_COUNT, SCALING_BATCH_SIZE, &result);
+    printf("%s,%d,%d,%d,%s,%.1f,%.1f,%.1f,%.1f,%.3f\n", sweep, workload->class_count,
+           workload->depth, workload->overloads, operation, result.ns_per_op, result.p50,
+           result.p90, result.p99, result.allocs_per_op);
+    fflush(stdout);
+}
+
+/*
+Measures the time taken to generate and free a whole workload and prints the results per class as
+a row of CSV
+
+*sweep: The name of the dimension that is being changed
+*workload: The workload whose sizes are used for each generated workload
+*/
+static void __print_import_row(char *sweep, workload_t *workload) {
+    bench_result_t result;
+    bench_measure(__import, workload, IMPORT_BATCH_COUNT, 1, &result);
+    double class_count = workload->class_count;
+    printf("%s,%d,%d,%d,%s,%.1f,%.1f,%.1f,%.1f,%.3f\n", sweep, workload->class_count,
+           workload->depth, workload->overloads, "import (per class)",
+           result.ns_per_op / class_count, result.p50 / class_count, result.p90 / class_count,
+           result.p99 / class_count, result.allocs_per_op / class_count);
+    fflush(stdout);
+}
+
+/*
+Generates and frees a workload with the same sizes as the given workload
+*/
+static void __import(void *data) {
+    workload_t *workload = (workload_t *)data;
+    workload_t generated;
+    __new_workload(&generated, workload->class_count, workload->depth, workload->overloads);
+    __free_workload(&generated);
+}
+
+/*
+Finds each of the generated classes in turn using its name
+*/
+static void __get_class(void *data) {
+    workload_t *workload = (workload_t *)data;
+    class_t *class;
+    bench_check(get_class(workload->prog_handler, &class,
+                          workload->class_names[workload->next_class]), "get a class");
+    workload->next_class = (workload->next_class + 1) % workload->class_count;
+}
+
+/*
+Runs 'method' for the last class of each chain in turn so that the Method Cache is used. Once
+there are more chains than entries in the Method Cache, functions must be found again
+*/
+static void __run_warm(void *data) {
+    workload_t *workload = (workload_t *)data;
+    bench_check(run_function(workload->prog_handler, workload->leaves[workload->next_leaf],
+                             "method", workload->return_var, workload->params, 1), "run method");
+    workload->next_leaf = (workload->next_leaf + 1) % workload->leaf_count;
+}
+
+/*
+Runs 'method' for the last class of a chain after clearing the Method Cache so that the Function
+must be found in the method tables each time
+*/
+static void __run_cold(void *data) {
+    workload_t *workload = (workload_t *)data;
+    mcache_invalidate(workload->prog_handler);
+    bench_check(run_function(workload->prog_handler, workload->leaves[0], "method",
+                             workload->return_var, workload->params, 1), "run method");
+}
+
+/*
+Creates, initialises and frees an instance of the last class of a chain which has a member field
+for each class in the chain
+*/
+static void __new_var(void *data) {
+    workload_t *workload = (workload_t *)data;
+    var_t *var = (var_t *)malloc(sizeof(var_t));
+    bench_check(new_var(workload->prog_handler, var), "create a variable");
+    bench_check(set_var_desc(workload->prog_handler, var,
+                             workload->class_names[workload->depth - 1], "var"),
+                "describe a variable");
+    bench_check(init_var(workload->prog_handler, var, NULL, 0), "initialise a variable");
+    free_var(var);
+}
+
+/*
+Gets the member field added by the last class of a chain, which is the last of its member fields
+*/
+static void __get_member_field(void *data) {
+    workload_t *workload = (workload_t *)data;
+    var_t *field;
+    bench_check(get_member_field(workload->prog_handler, workload->leaves[0], &field,
+                                 workload->leaf_field),
+                "get a member field");
+}
+
+/*
+Gets the member field added by the last class of a chain using its slot
+*/
+static void __get_member_field_slot(void *data) {
+    workload_t *workload = (workload_t *)data;
+    var_t *field;
+    bench_check(get_member_field_slot(workload->prog_handler, workload->leaves[0], &field,
+                                      workload->leaf_slot), "get a member field by slot");
+}
+
+/*
+Gets the member field added by the first class of a chain from an instance of the last class using
+a Field Handle resolved for the first class
+*/
+static void __get_member_field_h(void *data) {
+    workload_t *workload = (workload_t *)data;
+    var_t *field;
+    bench_check(get_member_field_h(workload->prog_handler, workload->leaves[0], &field,
+                                   workload->root_handle), "get a member field by handle");
+}
@@ -9,8 +9,8 @@ This file contains the code used to import the Language package and also create
 #include "pkg_dev_lang.h"
 #include "../src/typedefs.h"
 #include "../src/program-handlers/program-handler/program_handler.h"
-//#include "../src/types/Boolean"
-//#include "../src/types/Char"
+#include "../src/types/Boolean/t_Boolean.h"
+#include "../src/types/Char/t_Char.h"
 #include "../src/types/Error/t_Error.h"
 #include "../src/types/Error/main-types/ErrFunctionNotDefined/t_ErrFunctionNotDefined.h"
 //#include "../src/types/Error/main-types/ErrOutOfMemory"
@@ -24,6 +24,10 @@ prog_hand_t *new_lang_package() {
     return program_handler;
 }
 
+void free_lang_package(prog_hand_t *prog_handler) {
+    free_prog_hand(prog_handler);
+}
+
 inst_error_t *import_lang_package(prog_hand_t *prog_handler) {
     inst_error_t *error;
     
@@ -40,9 +44,19 @@ inst_error_t *import_lang_package(prog_hand_t *prog_handler) {
     cls_already_exists = false;
     if (!cls_already_exists) new_integer_cls(prog_handler);
 
+    class_exists(prog_handler, &cls_already_exists, NULL, BOOLEAN_CLS_NAME);
+    if (!cls_already_exists) new_boolean_cls(prog_handler);
+
+    class_exists(prog_handler, &cls_already_exists, NULL, CHAR_CLS_NAME);
+    if (!cls_already_exists) new_char_cls(prog_handler);
+
     class_exists(prog_handler, &cls_already_exists, NULL, ERROR_CLS_NAME);
     if (!cls_already_exists) new_error_cls(prog_handler);
 
     class_exists(prog_handler, &cls_already_exists, NULL, ERR_FUNCTION_NOT_DEFINED_CLS_NAME);
     if (!cls_already_exists) new_err_function_not_defined_cls(prog_handler);
+
+    // Build the method tables for each class
+    error = link_classes(prog_handler);
+    return error;
 }
\ No newline at end of file
@@ -60,6 +60,101 @@ Errors:
 */
 inst_error_t *init_class(prog_hand_t *prog_handler, class_t *class);
 
+/*
+Sets the class whose immediates are given a tag. Immediates have no description and store their data
+within the variable so only classes with unmanaged data no larger than a pointer may be used
+
+*prog_handler: The program handler that contains the class and error handlers
+*class: The class of the immediates
+tag: The tag given to the immediates, such as IMM_INTEGER
+
+Errors:
+    ErrInvalidParameters: Thrown if 'class' is set to NULL or 'tag' is not the tag of an immediate
+    ErrInvalidDataFormat: Thrown if the class uses managed data or its data is larger than a pointer
+*/
+inst_error_t *set_imm_class(prog_hand_t *prog_handler, class_t *class, int tag);
+
+/*
+Sets the hook run by the collector to mark the variables referred to by the unmanaged data of
+instances of a class. The hook calls gc_mark for each variable referred to by the instance it is
+given. Trace hooks are the only way for a tracked variable to keep another alive, as member fields
+are stored within their instance rather than referring to other variables
+
+*prog_handler: The program handler that contains the class and error handlers
+*class: The class whose instances are traced
+*trace: The hook that traces an instance, set to NULL to not trace the unmanaged data
+
+Errors:
+    ErrInvalidParameters: Thrown if 'class' is set to NULL
+    ErrInvalidDataFormat: Thrown if the class uses managed data
+*/
+inst_error_t *set_trace_hook(prog_hand_t *prog_handler, class_t *class,
+        inst_error_t *(*trace)(prog_hand_t *, var_t *));
+
+/*
+Marks a variable as reachable during a collection. Trace hooks call this for every variable referred
+to by the unmanaged data of an instance
+
+*prog_handler: The program handler that contains the Collector
+*var: The variable that is reachable, set to NULL to do nothing
+
+Errors:
+    ErrOutOfMemory: Thrown if there is not enough memory to trace the variable
+*/
+inst_error_t *gc_mark(prog_hand_t *prog_handler, var_t *var);
+
+/*
+Creates an immediate, a variable of a primitive class that has no description and stores its data
+within itself so that creating, running functions on and freeing it does not allocate memory. Any
+previous contents of the variable are not freed
+
+*prog_handler: The program handler that contains the classes of immediates
+*dest: The variable that will become the immediate
+tag: The tag of the class of the immediate, such as IMM_INTEGER
+*data: The data that is copied into the immediate, set to NULL to leave the data as zeroes
+
+Errors:
+    ErrInvalidParameters: Thrown if 'dest' is set to NULL or 'tag' is not the tag of an immediate
+    ErrClassNotDefined: Thrown if no class has been given the tag
+*/
+inst_error_t *new_immediate(prog_hand_t *prog_handler, var_t *dest, int tag, void *data);
+
+/*
+Creates a new instance of the class by using the given constructors to construct the instance
+
+*prog_handler: The program handler that contains the class and error handlers
+*dest: The destination to store the new instance variable into - Variable description must be set
+**params: The parameters used to construct the instance
+param_count: The number of parameters to use when creating the instance
+
+Errors: Any errors when initialising the instance
+    ErrInvalidParameters: Thrown if 'dest' or 'dest->desc' is set to NULL
+    ErrOutOfMemory: Thrown if there is not enough memory
+*/
+inst_error_t *init_var(prog_hand_t *prog_handler, var_t *dest, var_t **params, int param_count);
+
+/*
+Creates a number of new instances of the class in a single allocation, finding the class and its
+constructor once instead of for each instance. The member fields of instances with managed data are
+stored directly after the instances. Every instance shares a description with the given name and is
+constructed with the same parameters. Instances must not be freed with free_var, instead the whole
+array is freed with free_var_array
+
+*prog_handler: The program handler that contains the class and error handlers
+**dest: The destination to store the array of new instances into
+*class: The class of the instances
+*name: The name given to every instance
+count: The number of instances to create
+**params: The parameters used to construct each instance
+param_count: The number of parameters to use when creating each instance
+
+Errors: Any errors when initialising the instances
+    ErrInvalidParameters: Thrown if 'dest', 'class' or 'name' is set to NULL or 'count' is negative
+    ErrOutOfMemory: Thrown if there is not enough memory
+*/
+inst_error_t *new_var_array(prog_hand_t *prog_handler, var_array_t **dest, class_t *class,
+        char *name, int count, var_t **params, int param_count);
+
 /*
 Creates a new function by specifying every individual part of the function
 
@@ -101,6 +196,108 @@ inst_error_t *new_s_function(prog_hand_t *prog_handler, s_function_t *dest, char
         inst_error_t *(*function)(prog_hand_t *, var_t *,var_t **), class_t *return_type,
         class_t **param_types, int param_count);
 
+/*
+Links a class by building the method tables that contain its own functions as well as every function
+it inherits, so that a function can be found without searching each parent class. The field layout
+giving the slot of each member field in instances of the class is built at the same time. Classes
+are linked automatically before they are first used, and are unlinked whenever a function or member
+field is added to or removed from any class
+
+*prog_handler: The program handler that contains the class and error handlers
+*class: The class to link
+
+Errors:
+    ErrInvalidParameters: Thrown if 'class' is set to NULL
+    ErrOutOfMemory: Thrown if there is not enough memory to create the method tables
+    ErrVariableNameTaken: Thrown if a member field has the same name as an inherited member field
+*/
+inst_error_t *link_class(prog_hand_t *prog_handler, class_t *class);
+
+/*
+Links every class within the Class Handler. This should be done once all classes in a package have
+been initialised
+
+*prog_handler: The program handler that contains the class and error handlers
+
+Errors:
+    ErrOutOfMemory: Thrown if there is not enough memory to create the method tables
+*/
+inst_error_t *link_classes(prog_hand_t *prog_handler);
+
+/*
+Gets the Function that is run for instances of the class based upon the selector of the function
+name and the parameter classes. Functions that are found are stored in a cache shared by the whole
+program which is cleared whenever a function is added or removed
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The class of the instance the function is run for
+**dest: A pointer to the Function
+selector: The selector of the name of the function
+**param_types: The classes of the parameters
+param_count: The number of parameters
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self' or 'dest' is set to NULL
+    ErrFunctionNotDefined: Thrown if a function with the given parameters doesn't exist
+*/
+inst_error_t *get_function_sel(prog_hand_t *prog_handler, class_t *self, function_t **dest,
+        int selector, class_t **param_types, int param_count);
+
+/*
+Gets the Static Function that is run for the class based upon the selector of the function name and
+the parameter classes. Static Functions that are found are stored in a cache shared by the whole
+program which is cleared whenever a function is added or removed
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The class in which the function is located
+**dest: A pointer to the Static Function
+selector: The selector of the name of the function
+**param_types: The classes of the parameters
+param_count: The number of parameters
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self' or 'dest' is set to NULL
+    ErrFunctionNotDefined: Thrown if a function with the given parameters doesn't exist
+*/
+inst_error_t *get_s_function_sel(prog_hand_t *prog_handler, class_t *self, s_function_t **dest,
+        int selector, class_t **param_types, int param_count);
+
+/*
+Gets the Function that is run for instances of the class in the same way as 'get_function_sel'
+without throwing an error if the function does not exist
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The class of the instance the function is run for
+*found: A boolean value representing whether the Function was found
+**dest: A pointer to the Function which is only set if the Function was found
+selector: The selector of the name of the function
+**param_types: The classes of the parameters
+param_count: The number of parameters
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self', 'found' or 'dest' is set to NULL
+*/
+inst_error_t *try_get_function_sel(prog_hand_t *prog_handler, class_t *self, bool *found,
+        function_t **dest, int selector, class_t **param_types, int param_count);
+
+/*
+Gets the Static Function that is run for the class in the same way as 'get_s_function_sel' without
+throwing an error if the function does not exist
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The class in which the function is located
+*found: A boolean value representing whether the Static Function was found
+**dest: A pointer to the Static Function which is only set if the Static Function was found
+selector: The selector of the name of the function
+**param_types: The classes of the parameters
+param_count: The number of parameters
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self', 'found' or 'dest' is set to NULL
+*/
+inst_error_t *try_get_s_function_sel(prog_hand_t *prog_handler, class_t *self, bool *found,
+        s_function_t **dest, int selector, class_t **param_types, int param_count);
+
 /*
 Attempts to add a function to a class
 
@@ -189,7 +386,8 @@ inst_error_t *remove_s_function_by_name(prog_hand_t *prog_handler, class_t *clas
         class_t **param_types, int param_count);
 
 /*
-Attempts to add a member field to a class
+Attempts to add a member field to a class. Instances created before the member field is added keep
+the member fields they were created with
 
 *prog_handler: The program handler that contains the class and error handlers
 *class: The class to add the member field to
@@ -205,7 +403,8 @@ inst_error_t *add_member_field(prog_hand_t *prog_handler, class_t *class, char *
         class_t *type);
 
 /*
-Attempts to add a class variable to a class
+Attempts to add a class variable to a class. The class takes over the reference given to it and
+releases it when the class variable is removed or the class is freed
 
 *prog_handler: The program handler that contains the class and error handlers
 *class: The class to add the class variable to
@@ -213,10 +412,62 @@ Attempts to add a class variable to a class
 *type: The type of the class variable that is to be added
 
 Errors:
-    ErrInvalidParameters: Thrown if 'class' or 'class_var' is set to NULL
+    ErrInvalidParameters: Thrown if 'class' or 'class_var' is set to NULL or 'class_var' is an
+                          immediate or tracked by the collector
     ErrOutOfMemory: Thrown if there is not enough memory needed to add the class variable to the class
     ErrVariableNameTaken: Thrown if the given class variable already exists in the class
 */
 inst_error_t *add_class_var(prog_hand_t *prog_handler, class_t *class, var_t *class_var);
 
+/*
+Attempts to remove a class variable from a class, releasing the reference held by the class
+
+*prog_handler: The program handler that contains the class and error handlers
+*class: The class to remove the class variable from
+*name: The name of the class variable to remove
+
+Errors:
+    ErrInvalidParameters: Thrown if 'class' or 'name' is set to NULL
+*/
+inst_error_t *remove_class_var(prog_hand_t *prog_handler, class_t *class, char *name);
+
+/*
+Throws an error of the given type and returns a pointer to the error. If the error type does not
+exist, an error of the base Error class is thrown instead
+
+*prog_handler: The program handler that contains the class and error handlers
+*error_type: The name of the error type
+
+Returns: The error associated with the given type
+*/
+inst_error_t *new_error(prog_hand_t *prog_handler, char *error_type);
+
+/*
+Throws an error of the given class and returns a pointer to the error. Errors are not created when
+they are thrown but are instead the immutable instance preallocated for the class so that throwing
+and catching an error does not allocate memory. The returned error is shared by every error of the
+same class and must not be modified or freed
+
+*prog_handler: The program handler that contains the class and error handlers
+*error_class: The class of the error to throw
+
+Returns: The error associated with the given class
+*/
+inst_error_t *throw_error(prog_hand_t *prog_handler, cls_error_t *error_class);
+
+/*
+Gets the statistics of the Variable Pool that the descriptions, names and member fields of variables
+are allocated from. The number of blocks in use can be compared over time to find leaked variables
+
+*prog_handler: The program handler that contains the Variable Pool
+*live_blocks: A pointer to where the number of blocks in use will be stored
+*free_blocks: A pointer to where the number of freed blocks waiting to be reused will be stored
+*slab_bytes: A pointer to where the number of bytes allocated for slabs will be stored
+
+Errors:
+    ErrInvalidParameters: Thrown if 'live_blocks', 'free_blocks' or 'slab_bytes' is set to NULL
+*/
+inst_error_t *get_pool_stats(prog_hand_t *prog_handler, long *live_blocks, long *free_blocks,
+        size_t *slab_bytes);
+
 #endif
\ No newline at end of file
@@ -19,9 +19,19 @@ typedef struct gen_function function_t;
 typedef struct gen_class class_t;
 /* A structure that holds the various features contained in a Variable */
 typedef struct gen_var var_t;
+/* A structure that holds instances of a single class constructed together */
+typedef struct gen_var_array var_array_t;
+/* A structure that caches the Function resolved at a single place where a function is run */
+typedef struct gen_call_site call_site_t;
+/* A structure that holds the slot of a member field resolved once for a class and field name */
+typedef struct gen_field_handle field_handle_t;
 
 /* The class name that is used to represent an Integer */
 #define INTEGER_CLS_NAME "Integer"
+/* The class name that is used to represent a Boolean */
+#define BOOLEAN_CLS_NAME "Boolean"
+/* The class name that is used to represent a Char */
+#define CHAR_CLS_NAME "Char"
 /* The class name that is used to represent an Object */
 #define OBJECT_CLS_NAME "Object"
 /* The class name that is used to represent an Error */
@@ -41,6 +51,24 @@ typedef class_t cls_object_t;
 typedef inst_object_t inst_integer_t;
 /* A type of class used to represent an Integer class */
 typedef cls_object_t cls_integer_t;
+/* A type of variable used to represent a Boolean instance */
+typedef inst_object_t inst_boolean_t;
+/* A type of class used to represent a Boolean class */
+typedef cls_object_t cls_boolean_t;
+/* A type of variable used to represent a Char instance */
+typedef inst_object_t inst_char_t;
+/* A type of class used to represent a Char class */
+typedef cls_object_t cls_char_t;
+
+/*
+The tags of immediates, which are variables of primitive classes that have no description. The class
+of an immediate is found from its tag so that it can be used without allocating any memory
+*/
+#define IMM_NONE 0      // The variable is not an immediate and has a description
+#define IMM_INTEGER 1   // The variable is an immediate Integer
+#define IMM_BOOLEAN 2   // The variable is an immediate Boolean
+#define IMM_CHAR 3      // The variable is an immediate Char
+#define IMM_TAG_COUNT 4 // The number of tags including IMM_NONE
 
 #include <stdbool.h>
 
@@ -52,6 +80,14 @@ Returns: A reference to the created program handler
 */
 prog_hand_t *new_lang_package();
 
+/*
+Frees the program handler returned by new_lang_package along with every class, function and
+handler within it
+
+*prog_handler: The program handler to free
+*/
+void free_lang_package(prog_hand_t *prog_handler);
+
 /*
 Imports the Language package by creating and initialising each of the classes within the program
 
@@ -82,6 +118,71 @@ Errors: Throws any errors related to the function that is run
 inst_error_t *run_function(prog_hand_t *prog_handler, var_t *self, char *funct_name, 
         var_t *return_var, var_t **params, int param_count);
 
+/*
+Runs a function that is a part of a variable based upon the selector of the function name and the
+parameters. This avoids hashing and comparing the function name on each call
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The variable to run the function for
+selector: The selector of the name of the function to run, as returned by get_selector
+*return_var: The variable to store the return value after running the function
+**params: The list of parameters with which to run the function
+param_count: The number of parameters in the params list
+
+Returns: Returns a variable that is dependent on the function
+
+Errors: Throws any errors related to the function that is run
+    ErrInvalidParameters: Thrown if 'self' is set to NULL
+    ErrFunctionNotDefined: Thrown if a function using the given parameters does not exist
+*/
+inst_error_t *run_function_sel(prog_hand_t *prog_handler, var_t *self, int selector,
+        var_t *return_var, var_t **params, int param_count);
+
+/*
+Frees the memory occupied by a Call Site structure
+
+*src: The Call Site structure whose memory is to be freed
+*/
+void free_call_site(call_site_t *src);
+
+/*
+Creates a new Call Site for running the function with the given name and number of parameters.
+The Call Site caches the Function it finds so that running it repeatedly on variables of the same
+class does not need to find the Function again
+
+*prog_handler: The program handler that contains the class and error handlers
+*dest: A pointer to where the Call Site structure will be stored
+*funct_name: The name of the function that will be run
+param_count: The number of parameters that will be passed to the function
+
+Errors:
+    ErrInvalidParameters: Thrown if 'dest' or 'funct_name' is set to NULL or 'param_count' is
+                          negative
+    ErrOutOfMemory: Thrown if there is not enough memory to create the Call Site
+*/
+inst_error_t *new_call_site(prog_hand_t *prog_handler, call_site_t *dest, char *funct_name,
+        int param_count);
+
+/*
+Runs the function of the Call Site for a variable, using the cached Function if the variable and
+parameters have the same classes as when it was found
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The Call Site to run
+*variable: The variable to run the function for
+*return_var: The variable to store the return value after running the function
+**params: The list of parameters with which to run the function - Must contain the number of
+          parameters the Call Site was created with
+
+Returns: Returns a variable that is dependent on the function
+
+Errors: Throws any errors related to the function that is run
+    ErrInvalidParameters: Thrown if 'self' or 'variable' is set to NULL
+    ErrFunctionNotDefined: Thrown if a function using the given parameters does not exist
+*/
+inst_error_t *call_site_run(prog_hand_t *prog_handler, call_site_t *self, var_t *variable,
+        var_t *return_var, var_t **params);
+
 /*
 Runs a function as defined by the parent class of a type rather than using any overrided functions
 
@@ -123,6 +224,26 @@ Errors: Throws any errors related to the function that is run
 inst_error_t *run_s_function(prog_hand_t *prog_handler, class_t *self, char *funct_name, 
         var_t *return_var, var_t **params, int param_count);
 
+/*
+Runs a Static Function based upon the selector of the function name, passing in the relevant
+parameters. This avoids hashing and comparing the function name on each call
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The class in which the function is located
+selector: The selector of the name of the function to run, as returned by get_selector
+*return_var: The variable to store the return value after running the function
+**params: The list of parameters with which to run the function
+param_count: The number of parameters in the params list
+
+Returns: Returns a variable that is dependent on the function
+
+Errors: Throws any errors related to the function that is run
+    ErrInvalidParameters: Thrown if 'self' is set to NULL
+    ErrFunctionNotDefined: Thrown if a function with the given parameters doesn't exist
+*/
+inst_error_t *run_s_function_sel(prog_hand_t *prog_handler, class_t *self, int selector,
+        var_t *return_var, var_t **params, int param_count);
+
 /*
 Runs a Static Function passing in the relevant parameters and bypassing certain parent classes
 
@@ -232,7 +353,63 @@ Errors:
 inst_error_t *get_class(prog_hand_t *prog_handler, class_t **dest, char *class_name);
 
 /*
-Gets a specified class variable from the class based upon its name
+Gets a class from the Class Handler based upon the class ID assigned when it was added
+
+*prog_handler: The program handler that contains the class and error handlers
+**dest: The location to store the retrieved class pointer to
+class_id: The ID of the class to retrieve from the Class Handler
+
+Errors:
+    ErrInvalidParameters: Thrown if 'dest' is set to NULL
+    ErrClassNotDefined: Thrown if no class has been assigned the given class ID
+*/
+inst_error_t *get_class_by_id(prog_hand_t *prog_handler, class_t **dest, int class_id);
+
+/*
+Checks whether a class is the same as or inherits from another class. This takes the same time
+regardless of how deep the class tree is
+
+*prog_handler: The program handler that contains the class and error handlers
+*result: A pointer to the boolean where the result is stored
+*self: The class to check
+*parent: The class that 'self' may inherit from
+
+Errors:
+    ErrInvalidParameters: Thrown if 'result', 'self' or 'parent' is set to NULL
+    ErrOutOfMemory: Thrown if there is not enough memory to number the classes
+*/
+inst_error_t *is_subclass_of(prog_hand_t *prog_handler, bool *result, class_t *self,
+        class_t *parent);
+
+/*
+Gets the selector for a function name, interning the name if it has not been used before. The
+selector can be stored and passed to run_function_sel or run_s_function_sel
+
+*prog_handler: The program handler that contains the class and error handlers
+*dest: The location to store the selector
+*name: The function name to get the selector for
+
+Errors:
+    ErrInvalidParameters: Thrown if 'dest' or 'name' is set to NULL
+    ErrOutOfMemory: Thrown if there is not enough memory to intern the name
+*/
+inst_error_t *get_selector(prog_hand_t *prog_handler, int *dest, char *name);
+
+/*
+Gets the function name that a selector represents
+
+*prog_handler: The program handler that contains the class and error handlers
+**dest: The location to store the name - The name is owned by the program handler
+selector: The selector to get the name of
+
+Errors:
+    ErrInvalidParameters: Thrown if 'dest' is set to NULL or the selector has not been assigned
+*/
+inst_error_t *get_selector_name(prog_hand_t *prog_handler, char **dest, int selector);
+
+/*
+Gets a specified class variable from the class based upon its name. The class keeps its reference so
+the class variable must be retained if it is used after it may be removed
 
 *prog_handler: The program handler that contains the class and error handlers
 *self: The class that has the given class variable
@@ -246,24 +423,259 @@ inst_error_t *get_class_var(prog_hand_t *prog_handler, class_t *self, var_t **de
         char *var_name);
 
 /*
-Frees the memory occupuied by a Variable structure
+Gets the slot of a member field in instances of a class. Inherited member fields have the same slot
+in every subclass so the slot may be found once and used with get_member_field_slot for instances
+of the class and its subclasses
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The class that has the given member field
+*dest: A pointer to where the slot is stored
+*field_name: The name of the member field
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self', 'dest', or 'field_name' is set to NULL
+    ErrInvalidDataFormat: Thrown if the class does not use managed data
+    ErrVariableNotDefined: Thrown if the given member field does not exist
+*/
+inst_error_t *get_field_slot(prog_hand_t *prog_handler, class_t *self, int *dest,
+        char *field_name);
+
+/*
+Frees the memory occupied by a Variable structure including the member fields of instances with
+managed data without checking for other references to it. Variables created by new_pooled_var are
+returned to the Variable Pool. Variables stored within another structure, such as the instances of
+an array, only have their data freed as their memory is freed with the structure holding them
 
 *src: The Variable structure whose memory is to be freed
 */
 void free_var(var_t *src);
 
 /*
-Creates a new variable by resetting it to the default values
+Adds a reference to a Variable so that it is not freed until the reference is released with
+release_var. The count is not changed atomically so the variable must only be used by a single
+thread. Embedded variables, such as member fields, the instances of an array and thrown errors, are
+not counted as they last as long as the structure holding them
+
+*src: The Variable to reference
+*/
+void retain_var(var_t *src);
+
+/*
+Releases a reference to a Variable, freeing it with free_var once no references remain. Variables
+are created with a single reference. The count is not changed atomically and embedded variables are
+never freed by a release
+
+*src: The Variable to release, set to NULL to do nothing
+*/
+void release_var(var_t *src);
+
+/*
+Adds a reference to a Variable that may be shared between threads by changing the count atomically.
+Embedded variables are not counted
+
+*src: The Variable to reference
+*/
+void retain_var_atomic(var_t *src);
+
+/*
+Releases a reference to a Variable that may be shared between threads, freeing it with free_var once
+no references remain. Embedded variables are never freed by a release. The counts of the variable
+and of the description it shares with other instances are changed atomically, but the Variable Pool
+is not, so a release that may free the variable must not happen while another thread is creating
+or freeing variables
+
+*src: The Variable to release, set to NULL to do nothing
+*/
+void release_var_atomic(var_t *src);
+
+/*
+Creates a new variable by resetting it to the default values. The description of the variable is
+allocated from the Variable Pool so the variable must be freed before the program handler
 
 *dest: The variable that is to be reset
 
 Errors:
     ErrInvalidParameters: Thrown if 'dest' is set to NULL
+    ErrOutOfMemory: Thrown if there is not enough memory to create the description
 */
 inst_error_t *new_var(prog_hand_t *prog_handler, var_t *dest);
 
 /*
-Sets the values used to describe a variable that is required during initialisation
+Creates a new variable in memory from the Variable Pool rather than malloc and resets it to the
+default values. The variable is returned to the pool when it is freed with free_var
+
+*prog_handler: The program handler that contains the Variable Pool
+**dest: A pointer to where the created variable will be stored
+
+Errors:
+    ErrInvalidParameters: Thrown if 'dest' is set to NULL
+    ErrOutOfMemory: Thrown if there is not enough memory to create the variable
+*/
+inst_error_t *new_pooled_var(prog_hand_t *prog_handler, var_t **dest);
+
+/*
+Gets an instance from an array created by new_var_array. The instance is stored within the array so
+free_var only frees its data and the instance itself is freed by free_var_array
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The array to get an instance from
+**dest: The location to store the retrieved instance to
+index: The index of the instance within the array
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self' or 'dest' is set to NULL or 'index' is out of range
+*/
+inst_error_t *get_array_var(prog_hand_t *prog_handler, var_array_t *self, var_t **dest, int index);
+
+/*
+Frees every instance of an array created by new_var_array and the memory occupied by the array
+
+*src: The array to be freed, set to NULL to do nothing
+*/
+void free_var_array(var_array_t *src);
+
+/*
+Creates an immediate Integer which has no description and stores its value within the variable so
+that creating it, running functions on it and freeing it does not allocate memory. Immediates may be
+stack variables and only need to be freed with free_var if they were allocated with malloc
+
+*prog_handler: The program handler that contains the Integer class
+*dest: The variable that will become the immediate Integer
+value: The value of the Integer
+
+Errors:
+    ErrInvalidParameters: Thrown if 'dest' is set to NULL
+    ErrClassNotDefined: Thrown if the Integer class has not been created
+*/
+inst_error_t *new_integer(prog_hand_t *prog_handler, inst_integer_t *dest, int value);
+
+/*
+Creates an immediate Boolean which has no description and does not allocate memory
+
+*prog_handler: The program handler that contains the Boolean class
+*dest: The variable that will become the immediate Boolean
+value: The value of the Boolean
+
+Errors:
+    ErrInvalidParameters: Thrown if 'dest' is set to NULL
+    ErrClassNotDefined: Thrown if the Boolean class has not been created
+*/
+inst_error_t *new_boolean(prog_hand_t *prog_handler, inst_boolean_t *dest, bool value);
+
+/*
+Creates an immediate Char which has no description and does not allocate memory
+
+*prog_handler: The program handler that contains the Char class
+*dest: The variable that will become the immediate Char
+value: The value of the Char
+
+Errors:
+    ErrInvalidParameters: Thrown if 'dest' is set to NULL
+    ErrClassNotDefined: Thrown if the Char class has not been created
+*/
+inst_error_t *new_char(prog_hand_t *prog_handler, inst_char_t *dest, char value);
+
+/*
+Begins a new region. Until the region ends, every variable created with new_pooled_var along with
+the descriptions, member fields and data of any variable initialised is allocated within the region
+and discarded at once when it ends. Regions may be nested
+
+*prog_handler: The program handler that contains the Region
+
+Errors:
+    ErrOutOfMemory: Thrown if there is not enough memory to begin the region
+*/
+inst_error_t *region_begin(prog_hand_t *prog_handler);
+
+/*
+Ends the innermost region, discarding every variable allocated within it without freeing each one.
+Variables allocated within the region may be freed beforehand but must not be used afterwards
+
+*prog_handler: The program handler that contains the Region
+
+Errors:
+    ErrInvalidParameters: Thrown if no region has begun
+*/
+inst_error_t *region_end(prog_hand_t *prog_handler);
+
+/*
+Creates a new variable from the Variable Pool that is tracked by the collector and freed once it can
+no longer be reached. The variable must not be freed or released and must not be initialised within
+a region, and Variable Handlers such as the class variables of a class refuse to hold it. Creating a
+variable may begin a collection, so variables in use that are not reachable from a root must be
+pushed onto the shadow stack beforehand
+
+*prog_handler: The program handler that contains the Collector
+**dest: A pointer to where the created variable will be stored
+
+Errors:
+    ErrInvalidParameters: Thrown if 'dest' is set to NULL
+    ErrOutOfMemory: Thrown if there is not enough memory to create or track the variable
+*/
+inst_error_t *gc_new_var(prog_hand_t *prog_handler, var_t **dest);
+
+/*
+Registers a variable as a root so that it and every variable it refers to are not collected
+
+*prog_handler: The program handler that contains the Collector
+*root: The variable to register
+
+Errors:
+    ErrInvalidParameters: Thrown if 'root' is set to NULL
+    ErrOutOfMemory: Thrown if there is not enough memory to register the root
+*/
+inst_error_t *gc_add_root(prog_hand_t *prog_handler, var_t *root);
+
+/*
+Removes a variable registered as a root
+
+*prog_handler: The program handler that contains the Collector
+*root: The variable to remove
+
+Errors:
+    ErrVariableNotDefined: Thrown if the variable is not registered as a root
+*/
+inst_error_t *gc_remove_root(prog_hand_t *prog_handler, var_t *root);
+
+/*
+Pushes a variable onto the shadow stack so that it is not collected while it is in use, such as a
+temporary variable or a parameter of a running function
+
+*prog_handler: The program handler that contains the Collector
+*var: The variable to push
+
+Errors:
+    ErrInvalidParameters: Thrown if 'var' is set to NULL
+    ErrOutOfMemory: Thrown if there is not enough memory to push the variable
+*/
+inst_error_t *gc_push(prog_hand_t *prog_handler, var_t *var);
+
+/*
+Pops variables from the shadow stack once they are no longer in use
+
+*prog_handler: The program handler that contains the Collector
+count: The number of variables to pop
+
+Errors:
+    ErrInvalidParameters: Thrown if 'count' is negative or larger than the shadow stack
+*/
+inst_error_t *gc_pop(prog_hand_t *prog_handler, int count);
+
+/*
+Runs a whole collection at once, finishing any sweep in progress and then freeing every tracked
+variable that can not be reached
+
+*prog_handler: The program handler that contains the Collector
+
+Errors:
+    ErrOutOfMemory: Thrown if there is not enough memory to trace the variables, in which case no
+                    variables are freed by the collection
+*/
+inst_error_t *gc_collect(prog_hand_t *prog_handler);
+
+/*
+Sets the values used to describe a variable that is required during initialisation. Member fields
+share their description with their class so they are given a description of their own instead
 
 *prog_handler: The program handler that contains the class and error handlers
 *dest: A pointer to the variable
@@ -274,11 +686,13 @@ Errors:
     ErrInvalidParameters: Thrown if 'dest', 'type', or 'name' is NULL
     ErrOutOfMemory: Thrown if there is not enough space to copy the name
     ErrClassNotDefined: Thrown if the given class type does not exist in the class handler
+    ErrInvalidDataFormat: Thrown if the variable is an immediate which has no description
 */
 inst_error_t *set_var_desc(prog_hand_t *prog_handler, var_t *dest, char *type, char *name);
 
 /*
-Creates a new instance of a variable, copying the data exactly
+Creates a new instance of a variable, copying the data exactly. Data no larger than a pointer is
+stored within the variable itself so that no memory is allocated for it
 
 *prog_handler: The program handler that contains the class and error handlers
 *dest: The location to store the new variable
@@ -292,7 +706,7 @@ Errors:
 inst_error_t *init_var_exact(prog_hand_t *prog_handler, var_t *dest, void *data);
 
 /*
-Gets a member field from a variable that inherits from Object classes which use a Variable Handler
+Gets a member field from a variable that inherits from Object classes which use managed data
 
 *prog_handler: The program handler that contains the class and error handlers
 *self: The variable to get a member field from
@@ -302,17 +716,79 @@ Gets a member field from a variable that inherits from Object classes which use
 Errors:
     ErrInvalidParameters: Thrown if 'self', 'dest' or 'field_name' is set to NULL
     ErrVariableNotDefined: Thrown when the given field does not exist
-    ErrInvalidDataFormat: Thrown when the class does not handle its data using a Variable Handler
+    ErrInvalidDataFormat: Thrown when the class does not use managed data
 */
 inst_error_t *get_member_field(prog_hand_t *prog_handler, var_t *self, var_t **dest, 
         char *field_name);
 
 /*
-Gets the data from a variable that does not handle its data using a variable handler
+Gets a member field from a variable using the slot of the member field, as returned by
+get_field_slot, instead of its name. This avoids comparing the name of each member field
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The variable to get a member field from
+**dest: The location to store the retrieved member field to
+slot: The slot of the member field in the field layout of the class
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self' or 'dest' is set to NULL
+    ErrVariableNotDefined: Thrown when the instance does not have a member field in the slot
+    ErrInvalidDataFormat: Thrown when the class does not use managed data
+*/
+inst_error_t *get_member_field_slot(prog_hand_t *prog_handler, var_t *self, var_t **dest,
+        int slot);
+
+/*
+Frees the memory occupied by a Field Handle structure, releasing its reference to the description
+of the member field
+
+*src: The Field Handle structure whose memory is to be freed
+*/
+void free_field_handle(field_handle_t *src);
+
+/*
+Creates a new Field Handle for the member field with the given name in instances of a class. The
+Field Handle finds the slot of the member field once so that it can be used with get_member_field_h
+for instances of the class and its subclasses without comparing names
+
+*prog_handler: The program handler that contains the class and error handlers
+*dest: A pointer to where the Field Handle structure will be stored
+*class: The class that has the member field
+*field_name: The name of the member field
+
+Errors:
+    ErrInvalidParameters: Thrown if 'dest', 'class' or 'field_name' is set to NULL
+    ErrInvalidDataFormat: Thrown if the class does not use managed data
+    ErrVariableNotDefined: Thrown if the given member field does not exist
+*/
+inst_error_t *new_field_handle(prog_hand_t *prog_handler, field_handle_t *dest, class_t *class,
+        char *field_name);
+
+/*
+Gets a member field from a variable in constant time using a Field Handle. The variable may be an
+instance of the class the handle was created for or any of its subclasses
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The variable to get a member field from
+**dest: The location to store the retrieved member field to
+*handle: The Field Handle of the member field
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self', 'dest' or 'handle' is set to NULL
+    ErrInvalidDataFormat: Thrown when the class of the variable does not use managed data
+    ErrVariableNotDefined: Thrown when the variable does not have the member field, such as when it
+                           is not an instance of the class of the handle
+*/
+inst_error_t *get_member_field_h(prog_hand_t *prog_handler, var_t *self, var_t **dest,
+        field_handle_t *handle);
+
+/*
+Gets the data from a variable that does not handle its data using a variable handler. The pointer
+refers to the data wherever it is stored, including data stored within the variable itself
 
 *prog_handler: The program handler that contains the class and error handlers
 *self: The variable used to retrieve the data from
-**dest: A pointer to the data that is retrieved
+**dest: A pointer to where the pointer to the data will be stored
 
 Errors:
     ErrInvalidParameters: Thrown if 'self' or 'dest' is set to NULL
@@ -342,6 +818,30 @@ Errors:
 */
 inst_error_t *remove_err(prog_hand_t *prog_handler, char *error_name);
 
+/*
+Adds a class to the Error Handler using the class rather than its name. This takes constant time and
+does not allocate memory once the class has been added before
+
+*prog_handler: The program handler that contains the class and error handlers
+*error_class: The error class to add to the Error Handler
+
+Errors:
+    ErrInvalidParameters: Thrown if 'error_class' is set to NULL
+    ErrOutOfMemory: Thrown if there is not enough memory to add the error class
+*/
+inst_error_t *add_err_cls(prog_hand_t *prog_handler, cls_error_t *error_class);
+
+/*
+Deletes an error from the Error Handler using the class rather than its name
+
+*prog_handler: The program handler that contains the class and error handlers
+*error_class: The error class to delete from the Error Handler
+
+Errors:
+    ErrInvalidParameters: Thrown if 'error_class' is set to NULL
+*/
+inst_error_t *remove_err_cls(prog_hand_t *prog_handler, cls_error_t *error_class);
+
 /*
 Compares an instance of an error to the expected error that was to be produced
 
@@ -353,4 +853,15 @@ Returns: A boolean value representing whether the error and the given name is th
 */
 bool err_is_equal(inst_error_t *actual, char *expected);
 
+/*
+Compares an instance of an error to the class of the expected error. This is faster than comparing
+using the name of the error as only the classes are compared
+
+*actual: The error instance that was produced by the function
+*expected: The class of the error that was expected to occur
+
+Returns: A boolean value representing whether the error is an instance of the given class
+*/
+bool err_is_class(inst_error_t *actual, cls_error_t *expected);
+
 #endif
\ No newline at end of file
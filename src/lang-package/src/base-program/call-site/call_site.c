@@ -0,0 +1,120 @@
+/*
+Call Site
+By Ciaran Gruber
+
+The Call Site is a handle for a single place where a function is run. It is prepared once with the
+function name and parameter count and caches the Function that is resolved so that running it again
+on a receiver of the same class does not need to find the Function again
+
+File-specific:
+Call Site - Code File
+The code used to provide for the implementation of a Call Site
+*/
+
+#include "call_site.h"
+#include "../class/class.h"
+#include "../variable/variable.h"
+#include "../function/function.h"
+#include "../../program-handlers/error-handler/error_handler.h"
+#include "../../program-handlers/selector-handler/selector_handler.h"
+#include "../../types/type_creator.h"
+
+static inst_error_t *__resolve(prog_hand_t *prog_handler, call_site_t *self, class_t *var_class,
+        var_t **params);
+
+void free_call_site(call_site_t *src) {
+    if (src == NULL) return;
+
+    free(src->cached_params);
+    free(src);
+}
+
+inst_error_t *new_call_site(prog_hand_t *prog_handler, call_site_t *dest, char *funct_name,
+        int param_count) {
+    inst_error_t *error;
+    if (dest == NULL || funct_name == NULL || param_count < 0) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    // Intern name
+    error = get_selector(prog_handler, &(dest->selector), funct_name);
+    if (error != NULL) return error;
+    dest->param_count = param_count;
+
+    // Allocate parameter classes so that no allocation is required when running
+    dest->cached_params = (class_t **)malloc(param_count*sizeof(class_t *));
+    if (dest->cached_params == NULL && param_count > 0) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+    call_site_reset(dest);
+    return NULL;
+}
+
+inst_error_t *call_site_run(prog_hand_t *prog_handler, call_site_t *self, var_t *variable,
+        var_t *return_var, var_t **params) {
+    inst_error_t *error;
+    if (self == NULL || variable == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+    class_t *var_class = var_type(prog_handler, variable);
+
+    // Check whether the cached Function can be used
+    bool is_cached = self->cached_function != NULL && self->cached_class == var_class &&
+                     var_class->is_linked && self->cached_link == var_class->link_count;
+    for (int i = 0; is_cached && i < self->param_count; i++) {
+        is_cached = self->cached_params[i] == var_type(prog_handler, params[i]);
+    }
+
+    // Find Function again if the classes have changed
+    if (!is_cached) {
+        error = __resolve(prog_handler, self, var_class, params);
+        if (error != NULL) return error;
+    }
+    return function_run(prog_handler, self->cached_function, variable, return_var, params,
+                        self->param_count);
+}
+
+void call_site_reset(call_site_t *self) {
+    self->cached_class = NULL;
+    self->cached_link = 0;
+    self->cached_function = NULL;
+}
+
+/*
+Finds the Function for the Call Site and caches it along with the classes it was found for
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The Call Site to find the Function for
+*var_class: The class of the variable the function is being run for
+**params: The parameters the function is being run with
+
+Errors:
+    ErrFunctionNotDefined: Thrown if a function using the given parameters does not exist
+*/
+static inst_error_t *__resolve(prog_hand_t *prog_handler, call_site_t *self, class_t *var_class,
+        var_t **params) {
+    inst_error_t *error;
+    call_site_reset(self);
+
+    // Link the class first so that the link count stored matches the Function that is found
+    if (!var_class->is_linked) {
+        error = link_class(prog_handler, var_class);
+        if (error != NULL) return error;
+    }
+
+    // Get function using the parameter classes, falling back to the Method Cache shared by every
+    // Call Site before searching the method table
+    for (int i = 0; i < self->param_count; i++) {
+        self->cached_params[i] = var_type(prog_handler, params[i]);
+    }
+    error = get_function_sel(prog_handler, var_class, &(self->cached_function), self->selector,
+                             self->cached_params, self->param_count);
+    if (error != NULL) {
+        self->cached_function = NULL;
+        return error;
+    }
+
+    self->cached_class = var_class;
+    self->cached_link = var_class->link_count;
+    return NULL;
+}
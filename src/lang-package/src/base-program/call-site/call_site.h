@@ -0,0 +1,71 @@
+/*
+Call Site
+By Ciaran Gruber
+
+The Call Site is a handle for a single place where a function is run. It is prepared once with the
+function name and parameter count and caches the Function that is resolved so that running it again
+on a receiver of the same class does not need to find the Function again
+
+File-specific:
+Call Site - Header File
+The structures used to represent a Call Site
+*/
+
+#ifndef CALL_SITE
+#define CALL_SITE
+
+#include "../../typedefs.h"
+
+/*
+Frees the memory occupied by a Call Site structure. The cached Function is owned by the Function
+Handler of its class and is not freed
+
+*src: The Call Site structure whose memory is to be freed
+*/
+void free_call_site(call_site_t *src);
+
+/*
+Creates a new Call Site for running the function with the given name and number of parameters
+
+*prog_handler: The program handler that contains the class and error handlers
+*dest: A pointer to where the Call Site structure will be stored
+*funct_name: The name of the function that will be run
+param_count: The number of parameters that will be passed to the function
+
+Errors:
+    ErrInvalidParameters: Thrown if 'dest' or 'funct_name' is set to NULL or 'param_count' is
+                          negative
+    ErrOutOfMemory: Thrown if there is not enough memory to create the Call Site
+*/
+inst_error_t *new_call_site(prog_hand_t *prog_handler, call_site_t *dest, char *funct_name,
+        int param_count);
+
+/*
+Runs the function of the Call Site for a variable. The cached Function is used if the variable and
+parameters have the same classes as when it was resolved, otherwise the Function is found and
+cached again
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The Call Site to run
+*variable: The variable to run the function for
+*return_var: The variable to store the return value after running the function
+**params: The list of parameters with which to run the function - Must contain the number of
+          parameters the Call Site was created with
+
+Returns: Returns a variable that is dependent on the function
+
+Errors: Throws any errors related to the function that is run
+    ErrInvalidParameters: Thrown if 'self' or 'variable' is set to NULL
+    ErrFunctionNotDefined: Thrown if a function using the given parameters does not exist
+*/
+inst_error_t *call_site_run(prog_hand_t *prog_handler, call_site_t *self, var_t *variable,
+        var_t *return_var, var_t **params);
+
+/*
+Clears the Function cached by the Call Site so that it is found again when the Call Site is next run
+
+*self: The Call Site whose cache is to be cleared
+*/
+void call_site_reset(call_site_t *self);
+
+#endif
@@ -13,14 +13,23 @@ The code used to provide for the implementation of a Class
 #include <string.h>
 #include "class.h"
 #include "../variable/variable.h"
+#include "../variable/var_description.h"
+#include "../function/function.h"
 #include "../static-function/static_function.h"
+#include "../../program-handlers/program-handler/program_handler.h"
 #include "../../program-handlers/class-handler/class_handler.h"
 #include "../../program-handlers/error-handler/error_handler.h"
 #include "../../program-handlers/function-handler/function_handler.h"
 #include "../../program-handlers/static-function-handler/static_function_handler.h"
 #include "../../program-handlers/variable-handler/variable_handler.h"
 #include "../../program-handlers/variable-description-handler/var_desc_handler.h"
+#include "../../program-handlers/method-table/method_table.h"
+#include "../../program-handlers/static-method-table/static_method_table.h"
+#include "../../program-handlers/selector-handler/selector_handler.h"
+#include "../../program-handlers/method-cache/method_cache.h"
+#include "../../program-handlers/variable-pool/var_pool.h"
 #include "../../types/Object/t_Object.h"
+#include "../../types/type_creator.h"
 
 static inst_error_t *__get_s_function(prog_hand_t *prog_handler, s_function_t **dest, class_t *self,
         char *funct_name, class_t **param_types, int param_count);
@@ -28,15 +37,32 @@ static inst_error_t *__get_function(prog_hand_t *prog_handler, function_t **dest
         char *funct_name, class_t **param_types, int param_count);
 static inst_error_t *__convert_super(prog_hand_t *prog_handler, class_t *self,
         class_t **super_class, int parent_levels);
+static inst_error_t *__try_get_constructor(prog_hand_t *prog_handler, bool *found,
+        function_t **dest, class_t *self, var_t **params, int param_count);
 
 void free_class(class_t *src) {
     if (src == NULL) return;
 
-    free(src->class_name);
+    // The class, its name and its Function Handlers are held in the Metadata Arena
     free_s_funct_hand(src->static_methods);
     free_funct_hand(src->inst_methods);
     free_var_hand(src->class_vars);
     free_var_desc_hand(src->mem_fields);
+    free_mtable(src->inst_table);
+    free_smtable(src->static_table);
+    free_field_layout(src->field_layout, src->field_count);
+    free_inst_fields(src->prototype);
+    if (src->error_inst != NULL) {
+        free_var_desc(src->error_inst->desc);
+    }
+}
+
+void free_field_layout(var_desc_t **src, int field_count) {
+    if (src == NULL) return;
+
+    for (int i = 0; i < field_count; i++) {
+        free_var_desc(src[i]);
+    }
     free(src);
 }
 
@@ -47,22 +73,20 @@ inst_error_t *init_var(prog_hand_t *prog_handler, var_t *dest, var_t **params,
         return new_error(prog_handler, "ErrInvalidParameters");
     }
 
-    // Free existing data if source is initialised
-    if (dest->initialised = true) {
-        free(dest->data);
-    }
-
-    // Run object constructor
+    // Run object constructor which also frees any existing data
     error = init_object_inst(prog_handler, dest, NULL, NULL);
+    if (error != NULL) return error;
 
     // Run constructor for specific class. If there is no constructor, leave as-is
-    class_t *class = dest->desc->type;
-    add_err(prog_handler, "ErrFunctionNotDefined");
-    error = run_function(prog_handler, dest, class->class_name, dest, params, param_count);
-    // Check error
-    if (error == NULL || !err_is_equal(error, "ErrFunctionNotDefined")) {
-        remove_err(prog_handler, "ErrFunctionNotDefined");
-        return error;
+    bool found;
+    function_t *constructor;
+    error = __try_get_constructor(prog_handler, &found, &constructor, dest->desc->type, params,
+                                  param_count);
+    if (error != NULL) return error;
+    // The constructor was matched to the parameters when it was found so it is run directly
+    if (found) {
+        error = constructor->function(prog_handler, dest, dest, params);
+        if (error != NULL) return error;
     }
 
     // Mark as initialised
@@ -70,6 +94,90 @@ inst_error_t *init_var(prog_hand_t *prog_handler, var_t *dest, var_t **params,
     return NULL;
 }
 
+inst_error_t *new_var_array(prog_hand_t *prog_handler, var_array_t **dest, class_t *class,
+        char *name, int count, var_t **params, int param_count) {
+    inst_error_t *error;
+    if (dest == NULL || class == NULL || name == NULL || count < 0) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    // The field layout is built when the class is linked
+    if (!class->is_linked) {
+        error = link_class(prog_handler, class);
+        if (error != NULL) return error;
+    }
+    bool found;
+    function_t *constructor;
+    error = __try_get_constructor(prog_handler, &found, &constructor, class, params, param_count);
+    if (error != NULL) return error;
+
+    // Each member field block has a header without a size class so that freeing an instance leaves
+    // the block within the array, in the same way as blocks within a region
+    size_t block_size = 0;
+    if (class->has_managed_data && class->field_count > 0) {
+        block_size = sizeof(pool_block_t) + sizeof(inst_fields_t) +
+                     class->field_count*sizeof(var_t);
+    }
+    var_array_t *array = (var_array_t *)pool_alloc(prog_handler, sizeof(var_array_t) +
+                                                   count*(sizeof(var_t) + block_size));
+    if (array == NULL) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+    array->count = 0;
+    array->vars = (var_t *)(array + 1);
+    char *blocks = (char *)(array->vars + count);
+
+    // Every instance shares a single description
+    array->desc = (var_desc_t *)pool_alloc(prog_handler, sizeof(var_desc_t));
+    if (array->desc == NULL) {
+        pool_free(array);
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+    new_var_desc(prog_handler, array->desc);
+    error = init_var_desc(prog_handler, array->desc, class->class_name, name);
+    if (error != NULL) {
+        free_var_array(array);
+        return error;
+    }
+
+    for (int i = 0; i < count; i++) {
+        var_t *var = &(array->vars[i]);
+        var->desc = array->desc;
+        retain_var_desc(var->desc);
+        var->data = NULL;
+        var->initialised = false;
+        var->pooled = false;
+        var->embedded = true;
+        var->inline_data = false;
+        var->gc_flags = 0;
+        var->imm_tag = IMM_NONE;
+        atomic_init(&(var->ref_count), 1);
+        // Count the instance first so that it is freed if constructing it fails
+        array->count++;
+
+        if (block_size > 0) {
+            pool_block_t *header = (pool_block_t *)(blocks + i*block_size);
+            header->size_class = NULL;
+            var->data = header + 1;
+            error = copy_prototype(prog_handler, class, (inst_fields_t *)var->data);
+            if (error != NULL) break;
+        }
+        // The constructor was matched to the parameters when it was found so it is run directly
+        if (found) {
+            error = constructor->function(prog_handler, var, var, params);
+            if (error != NULL) break;
+        }
+        var->initialised = true;
+    }
+    if (error != NULL) {
+        free_var_array(array);
+        return error;
+    }
+
+    *dest = array;
+    return NULL;
+}
+
 inst_error_t *run_super_s_function(prog_hand_t *prog_handler, class_t *self, char *funct_name, 
         var_t *return_var, var_t **params, int param_count, int super_amount) {
     inst_error_t *error;
@@ -88,21 +196,45 @@ inst_error_t *run_s_function(prog_hand_t *prog_handler, class_t *self, char *fun
         return new_error(prog_handler, "ErrInvalidParameters");
     }
 
-    // Get params as class list
-    class_t **param_types = (class_t **)malloc(param_count*sizeof(class_t *));
-    if (param_types == NULL) {
-        return new_error(prog_handler, "ErrOutOfMemory");
+    // A function can not exist if its name has never been interned
+    bool sel_exists;
+    int selector;
+    error = selector_exists(prog_handler, &sel_exists, &selector, funct_name);
+    if (error != NULL) return error;
+    if (!sel_exists) {
+        return new_error(prog_handler, "ErrFunctionNotDefined");
+    }
+
+    return run_s_function_sel(prog_handler, self, selector, return_var, params, param_count);
+}
+
+inst_error_t *run_s_function_sel(prog_hand_t *prog_handler, class_t *self, int selector,
+        var_t *return_var, var_t **params, int param_count) {
+    inst_error_t *error;
+    if (self == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    // Get params as class list, only allocating if there are too many to store on the stack
+    class_t *stack_types[MAX_STACK_PARAMS];
+    class_t **param_types = stack_types;
+    if (param_count > MAX_STACK_PARAMS) {
+        param_types = (class_t **)malloc(param_count*sizeof(class_t *));
+        if (param_types == NULL) {
+            return new_error(prog_handler, "ErrOutOfMemory");
+        }
     }
     for (int i = 0; i < param_count; i++) {
-        param_types[i] = params[i]->desc->type;
+        param_types[i] = var_type(prog_handler, params[i]);
     }
 
     // Get function
     s_function_t *function;
-    __get_s_function(prog_handler, &function, self, funct_name, param_types, param_count);
-    if (function == NULL) {
-        return new_error(prog_handler, "ErrFunctionNotDefined");
+    error = get_s_function_sel(prog_handler, self, &function, selector, param_types, param_count);
+    if (param_types != stack_types) {
+        free(param_types);
     }
+    if (error != NULL) return error;
     // Run function
     error = s_function_run(prog_handler, function, return_var, params, param_count);
     return error;
@@ -129,10 +261,8 @@ inst_error_t *get_return_type(prog_hand_t *prog_handler, class_t *self, char *fu
 
     // Get function
     function_t *function;
-    __get_function(prog_handler, &function, self, funct_name, param_types, param_count);
-    if (function == NULL) {
-        return new_error(prog_handler, "ErrFunctionNotDefined");
-    }
+    error = __get_function(prog_handler, &function, self, funct_name, param_types, param_count);
+    if (error != NULL) return error;
     // Set return type
     *return_type = function->return_type;
     return NULL;
@@ -159,15 +289,99 @@ inst_error_t *get_s_return_type(prog_hand_t *prog_handler, class_t *self, char *
 
     // Get function
     s_function_t *function;
-    __get_s_function(prog_handler, &function, self, funct_name, param_types, param_count);
-    if (function == NULL) {
-        return new_error(prog_handler, "ErrFunctionNotDefined");
-    }
+    error = __get_s_function(prog_handler, &function, self, funct_name, param_types, param_count);
+    if (error != NULL) return error;
     // Set return type
     *return_type = function->return_type;
     return NULL;
 }
 
+inst_error_t *get_function_sel(prog_hand_t *prog_handler, class_t *self, function_t **dest,
+        int selector, class_t **param_types, int param_count) {
+    inst_error_t *error;
+    if (self == NULL || dest == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    // Attempt to get function
+    bool found;
+    error = try_get_function_sel(prog_handler, self, &found, dest, selector, param_types,
+                                 param_count);
+    if (error != NULL) return error;
+    if (!found) {
+        return new_error(prog_handler, "ErrFunctionNotDefined");
+    }
+    return NULL;
+}
+
+inst_error_t *try_get_function_sel(prog_hand_t *prog_handler, class_t *self, bool *found,
+        function_t **dest, int selector, class_t **param_types, int param_count) {
+    inst_error_t *error;
+    if (self == NULL || found == NULL || dest == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    // Check whether the function has already been found for the same classes
+    error = mcache_get_function(prog_handler, found, dest, self, selector, param_types,
+                                param_count);
+    if (error != NULL) return error;
+    if (*found) return NULL;
+
+    // Build the method tables if the class has changed since it was last linked
+    if (!self->is_linked) {
+        error = link_class(prog_handler, self);
+        if (error != NULL) return error;
+    }
+    // Get function from the table of own and inherited functions
+    error = mtable_try_get_function_sel(prog_handler, self->inst_table, found, dest, selector,
+                                        param_types, param_count);
+    if (error != NULL || !*found) return error;
+    return mcache_add_function(prog_handler, *dest, self, param_types, param_count);
+}
+
+inst_error_t *get_s_function_sel(prog_hand_t *prog_handler, class_t *self, s_function_t **dest,
+        int selector, class_t **param_types, int param_count) {
+    inst_error_t *error;
+    if (self == NULL || dest == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    // Attempt to get function
+    bool found;
+    error = try_get_s_function_sel(prog_handler, self, &found, dest, selector, param_types,
+                                   param_count);
+    if (error != NULL) return error;
+    if (!found) {
+        return new_error(prog_handler, "ErrFunctionNotDefined");
+    }
+    return NULL;
+}
+
+inst_error_t *try_get_s_function_sel(prog_hand_t *prog_handler, class_t *self, bool *found,
+        s_function_t **dest, int selector, class_t **param_types, int param_count) {
+    inst_error_t *error;
+    if (self == NULL || found == NULL || dest == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    // Check whether the function has already been found for the same classes
+    error = mcache_get_s_function(prog_handler, found, dest, self, selector, param_types,
+                                  param_count);
+    if (error != NULL) return error;
+    if (*found) return NULL;
+
+    // Build the method tables if the class has changed since it was last linked
+    if (!self->is_linked) {
+        error = link_class(prog_handler, self);
+        if (error != NULL) return error;
+    }
+    // Get function from the table of own and inherited functions
+    error = smtable_try_get_function_sel(prog_handler, self->static_table, found, dest, selector,
+                                         param_types, param_count);
+    if (error != NULL || !*found) return error;
+    return mcache_add_s_function(prog_handler, *dest, self, param_types, param_count);
+}
+
 inst_error_t *get_class_var(prog_hand_t *prog_handler, class_t *self, var_t **dest,
         char *var_name) {
     inst_error_t *error;
@@ -175,8 +389,37 @@ inst_error_t *get_class_var(prog_hand_t *prog_handler, class_t *self, var_t **de
         return new_error(prog_handler, "ErrInvalidParameters");
     }
 
-    error = get_var(prog_handler, self->class_vars, dest, var_name);
-    return error;
+    bool found;
+    error = try_get_var(prog_handler, self->class_vars, &found, dest, var_name);
+    if (error != NULL) return error;
+    if (!found) {
+        return new_error(prog_handler, "ErrVariableNotDefined");
+    }
+    return NULL;
+}
+
+inst_error_t *get_field_slot(prog_hand_t *prog_handler, class_t *self, int *dest,
+        char *field_name) {
+    inst_error_t *error;
+    if (self == NULL || dest == NULL || field_name == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+    if (!self->has_managed_data) {
+        return new_error(prog_handler, "ErrInvalidDataFormat");
+    }
+
+    // The field layout is built when the class is linked
+    if (!self->is_linked) {
+        error = link_class(prog_handler, self);
+        if (error != NULL) return error;
+    }
+    for (int i = 0; i < self->field_count; i++) {
+        if (!strcmp(self->field_layout[i]->name, field_name)) {
+            *dest = i;
+            return NULL;
+        }
+    }
+    return new_error(prog_handler, "ErrVariableNotDefined");
 }
 
 inst_error_t *get_parent(prog_hand_t *prog_handler, class_t *self, class_t **dest) {
@@ -189,6 +432,23 @@ inst_error_t *get_parent(prog_hand_t *prog_handler, class_t *self, class_t **des
     return NULL;
 }
 
+inst_error_t *is_subclass_of(prog_hand_t *prog_handler, bool *result, class_t *self,
+        class_t *parent) {
+    inst_error_t *error;
+    if (result == NULL || self == NULL || parent == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    // Number classes if a class has been added since they were last numbered
+    if (!prog_handler->cls_handler->is_numbered) {
+        error = number_classes(prog_handler);
+        if (error != NULL) return error;
+    }
+    // Every subclass is numbered within the subtree of its parent classes
+    *result = parent->pre_order <= self->pre_order && self->pre_order < parent->subtree_end;
+    return NULL;
+}
+
 static inst_error_t *__convert_super(prog_hand_t *prog_handler, class_t *self,
         class_t **super_class, int parent_levels) {
     inst_error_t *error;
@@ -212,70 +472,85 @@ static inst_error_t *__get_s_function(prog_hand_t *prog_handler, s_function_t **
         char *funct_name, class_t **param_types, int param_count) {
     inst_error_t *error;
 
-    // Loop through parent classes until a suitable function is found
-    while (self != NULL) {
-        // Attempt to get function
-        add_err(prog_handler, "ErrFunctionNotDefined");
-        error = sfhand_get_function(prog_handler, self->static_methods, dest, funct_name, 
-                                    param_types, param_count);
-
-        if (!err_is_equal(error, "ErrFunctionNotDefined")) { // Function was found
-            remove_err(prog_handler, "ErrFunctionNotDefined");
-            return error;
-        }
-
-        get_parent(prog_handler, self, &self);
-        // Function can not be run if a parent does not have managed data
-        if (!self->has_managed_data) {
-            break;
-        }
-    }
-    // Attempt to get function from object class
-    if (self != NULL) {
-        // Get class
-        cls_object_t *class;
-        error = get_class(prog_handler, &class, OBJECT_CLS_NAME);
-        if (error != NULL) return error;
-        // Get function and return any errors
-        return sfhand_get_function(prog_handler, self->static_methods, dest, funct_name,
-                                    param_types, param_count);
+    // A function can not exist if its name has never been interned
+    bool sel_exists;
+    int selector;
+    error = selector_exists(prog_handler, &sel_exists, &selector, funct_name);
+    if (error != NULL) return error;
+    if (!sel_exists) {
+        return new_error(prog_handler, "ErrFunctionNotDefined");
     }
-    // Return ErrFunctionNotDefined
-    return new_error(prog_handler, "ErrFunctionNotDefined");
+    return get_s_function_sel(prog_handler, self, dest, selector, param_types, param_count);
 }
 
 static inst_error_t *__get_function(prog_hand_t *prog_handler, function_t **dest, class_t *self,
         char *funct_name, class_t **param_types, int param_count) {
     inst_error_t *error;
 
-    // Loop through parent classes until a suitable function is found
-    while (self != NULL) {
-        // Attempt to get function
-        add_err(prog_handler, "ErrFunctionNotDefined");
-        error = fhand_get_function(prog_handler, self->inst_methods, dest, funct_name, param_types,
-                                    param_count);
+    // A function can not exist if its name has never been interned
+    bool sel_exists;
+    int selector;
+    error = selector_exists(prog_handler, &sel_exists, &selector, funct_name);
+    if (error != NULL) return error;
+    if (!sel_exists) {
+        return new_error(prog_handler, "ErrFunctionNotDefined");
+    }
+    return get_function_sel(prog_handler, self, dest, selector, param_types, param_count);
+}
 
-        if (!err_is_equal(error, "ErrFunctionNotDefined")) { // Function was found
-            remove_err(prog_handler, "ErrFunctionNotDefined");
-            return error;
+/*
+Gets the constructor of a class for the given parameters without throwing an error if the class does
+not have a constructor. The constructor is the Function with the same name as the class. The
+constructor run without parameters is cached on the class when it is linked
+
+*prog_handler: The program handler that contains the class and error handlers
+*found: A boolean value representing whether the constructor was found
+**dest: A pointer to the constructor which is only set if the constructor was found
+*self: The class to get the constructor of
+**params: The parameters that the constructor is run with
+param_count: The number of parameters
+
+Errors:
+    ErrOutOfMemory: Thrown if there are too many parameters to store on the stack and there is not
+                    enough memory to store them
+*/
+static inst_error_t *__try_get_constructor(prog_hand_t *prog_handler, bool *found,
+        function_t **dest, class_t *self, var_t **params, int param_count) {
+    inst_error_t *error;
+
+    // The constructor run without parameters is found when the class is linked
+    if (param_count == 0) {
+        if (!self->is_linked) {
+            error = link_class(prog_handler, self);
+            if (error != NULL) return error;
         }
+        *found = self->constructor != NULL;
+        *dest = self->constructor;
+        return NULL;
+    }
 
-        get_parent(prog_handler, self, &self);
-        // Function can not be run if a parent does not have managed data
-        if (!self->has_managed_data) {
-            break;
+    // A constructor can not exist if the class name has never been interned
+    int selector;
+    error = selector_exists(prog_handler, found, &selector, self->class_name);
+    if (error != NULL || !*found) return error;
+
+    // Get params as class list, only allocating if there are too many to store on the stack
+    class_t *stack_types[MAX_STACK_PARAMS];
+    class_t **param_types = stack_types;
+    if (param_count > MAX_STACK_PARAMS) {
+        param_types = (class_t **)malloc(param_count*sizeof(class_t *));
+        if (param_types == NULL) {
+            return new_error(prog_handler, "ErrOutOfMemory");
         }
     }
-    // Attempt to get function from object class
-    if (self != NULL) {
-        // Get class
-        cls_object_t *class;
-        error = get_class(prog_handler, &class, OBJECT_CLS_NAME);
-        if (error != NULL) return error;
-        // Get function and return any errors
-        return fhand_get_function(prog_handler, self->inst_methods, dest, funct_name, param_types,
-                                    param_count);
+    for (int i = 0; i < param_count; i++) {
+        param_types[i] = var_type(prog_handler, params[i]);
+    }
+
+    error = try_get_function_sel(prog_handler, self, found, dest, selector, param_types,
+                                 param_count);
+    if (param_types != stack_types) {
+        free(param_types);
     }
-    // Return ErrFunctionNotDefined
-    return new_error(prog_handler, "ErrFunctionNotDefined");
+    return error;
 }
\ No newline at end of file
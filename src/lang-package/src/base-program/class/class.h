@@ -14,16 +14,27 @@ The structures used to represent a Class
 #define CLASS
 
 #define MAX_FUNCT 50
+/* The number of parameter classes that are stored on the stack when running a function */
+#define MAX_STACK_PARAMS 8
 
 #include "../../typedefs.h"
 
 /*
-Frees the memory occupuied by a Class structure
+Frees the memory occupuied by a Class structure that is not held in the Metadata Arena. The class
+itself is held in the arena and is freed along with the program handler
 
 *src: The Class structure whose memory is to be freed 
 */
 void free_class(class_t *dest);
 
+/*
+Frees a field layout, releasing the reference it holds to the description of each member field
+
+**src: The field layout to free
+field_count: The number of member fields in the field layout
+*/
+void free_field_layout(var_desc_t **src, int field_count);
+
 /*
 Creates a new instance of the class by using the given constructors to construct the instance
 
@@ -38,6 +49,28 @@ Errors: Any errors when initialising the instance
 */
 inst_error_t *init_var(prog_hand_t *prog_handler, var_t *dest, var_t **params, int param_count);
 
+/*
+Creates a number of new instances of the class in a single allocation, finding the class and its
+constructor once instead of for each instance. The member fields of instances with managed data are
+stored directly after the instances. Every instance shares a description with the given name and is
+constructed with the same parameters. Instances must not be freed with free_var, instead the whole
+array is freed with free_var_array
+
+*prog_handler: The program handler that contains the class and error handlers
+**dest: The destination to store the array of new instances into
+*class: The class of the instances
+*name: The name given to every instance
+count: The number of instances to create
+**params: The parameters used to construct each instance
+param_count: The number of parameters to use when creating each instance
+
+Errors: Any errors when initialising the instances
+    ErrInvalidParameters: Thrown if 'dest', 'class' or 'name' is set to NULL or 'count' is negative
+    ErrOutOfMemory: Thrown if there is not enough memory
+*/
+inst_error_t *new_var_array(prog_hand_t *prog_handler, var_array_t **dest, class_t *class,
+        char *name, int count, var_t **params, int param_count);
+
 /*
 Runs a Static Function passing in the relevant parameters and bypassing certain parent classes
 
@@ -82,6 +115,28 @@ Errors: Throws any errors related to the function that is run
 inst_error_t *run_s_function(prog_hand_t *prog_handler, class_t *self, char *funct_name, 
         var_t *return_var, var_t **params, int param_count);
 
+/*
+Runs a Static Function based upon the selector of the function name, passing in the relevant
+parameters. This avoids hashing and comparing the function name on each call
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The class in which the function is located
+selector: The selector of the name of the function to run, as returned by get_selector
+*return_var: The variable to store the return value after running the function
+**params: The list of parameters with which to run the function
+param_count: The number of parameters in the params list
+
+Returns: Returns a variable that is dependent on the function
+
+Errors: Throws any errors related to the function that is run
+    ErrInvalidParameters: Thrown if 'self' is set to NULL
+    ErrFunctionNotDefined: Thrown if a function with the given parameters doesn't exist
+    ErrOutOfMemory: Thrown if there is not enough memory to construct a class list for the
+                    parameters
+*/
+inst_error_t *run_s_function_sel(prog_hand_t *prog_handler, class_t *self, int selector,
+        var_t *return_var, var_t **params, int param_count);
+
 /*
 Gets the return type of the Function that would be run as defined by a parent class
 
@@ -155,7 +210,82 @@ inst_error_t *get_s_return_type(prog_hand_t *prog_handler, class_t *self, char *
         class_t **return_type, class_t **param_types, int param_count);
 
 /*
-Gets a specified class variable from the class based upon its name
+Gets the Function that is run for instances of the class based upon the selector of the function
+name and the parameter classes. The Method Cache is checked before the method tables and the
+Function found is added to the Method Cache
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The class of the instance the function is run for
+**dest: A pointer to the Function
+selector: The selector of the name of the function
+**param_types: The classes of the parameters
+param_count: The number of parameters
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self' or 'dest' is set to NULL
+    ErrFunctionNotDefined: Thrown if a function with the given parameters doesn't exist
+*/
+inst_error_t *get_function_sel(prog_hand_t *prog_handler, class_t *self, function_t **dest,
+        int selector, class_t **param_types, int param_count);
+
+/*
+Gets the Function that is run for instances of the class in the same way as 'get_function_sel'
+without throwing an error if the function does not exist
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The class of the instance the function is run for
+*found: A boolean value representing whether the Function was found
+**dest: A pointer to the Function which is only set if the Function was found
+selector: The selector of the name of the function
+**param_types: The classes of the parameters
+param_count: The number of parameters
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self', 'found' or 'dest' is set to NULL
+*/
+inst_error_t *try_get_function_sel(prog_hand_t *prog_handler, class_t *self, bool *found,
+        function_t **dest, int selector, class_t **param_types, int param_count);
+
+/*
+Gets the Static Function that is run for the class based upon the selector of the function name and
+the parameter classes. The Method Cache is checked before the method tables and the Static
+Function found is added to the Method Cache
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The class in which the function is located
+**dest: A pointer to the Static Function
+selector: The selector of the name of the function
+**param_types: The classes of the parameters
+param_count: The number of parameters
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self' or 'dest' is set to NULL
+    ErrFunctionNotDefined: Thrown if a function with the given parameters doesn't exist
+*/
+inst_error_t *get_s_function_sel(prog_hand_t *prog_handler, class_t *self, s_function_t **dest,
+        int selector, class_t **param_types, int param_count);
+
+/*
+Gets the Static Function that is run for the class in the same way as 'get_s_function_sel' without
+throwing an error if the function does not exist
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The class in which the function is located
+*found: A boolean value representing whether the Static Function was found
+**dest: A pointer to the Static Function which is only set if the Static Function was found
+selector: The selector of the name of the function
+**param_types: The classes of the parameters
+param_count: The number of parameters
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self', 'found' or 'dest' is set to NULL
+*/
+inst_error_t *try_get_s_function_sel(prog_hand_t *prog_handler, class_t *self, bool *found,
+        s_function_t **dest, int selector, class_t **param_types, int param_count);
+
+/*
+Gets a specified class variable from the class based upon its name. The class keeps its reference so
+the class variable must be retained if it is used after it may be removed
 
 *prog_handler: The program handler that contains the class and error handlers
 *self: The class that has the given class variable
@@ -169,6 +299,24 @@ Errors:
 inst_error_t *get_class_var(prog_hand_t *prog_handler, class_t *self, var_t **dest,
         char *var_name);
 
+/*
+Gets the slot of a member field in instances of a class. Inherited member fields have the same slot
+in every subclass so the slot may be found once and used with get_member_field_slot for instances
+of the class and its subclasses
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The class that has the given member field
+*dest: A pointer to where the slot is stored
+*field_name: The name of the member field
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self', 'dest', or 'field_name' is set to NULL
+    ErrInvalidDataFormat: Thrown if the class does not use managed data
+    ErrVariableNotDefined: Thrown if the given member field does not exist
+*/
+inst_error_t *get_field_slot(prog_hand_t *prog_handler, class_t *self, int *dest,
+        char *field_name);
+
 /*
 Gets a reference to the parent of the specified class
 
@@ -181,4 +329,20 @@ Errors:
 */
 inst_error_t *get_parent(prog_hand_t *prog_handler, class_t *self, class_t **dest);
 
+/*
+Checks whether a class is the same as or inherits from another class. This takes the same time
+regardless of how deep the class tree is
+
+*prog_handler: The program handler that contains the class and error handlers
+*result: A pointer to the boolean where the result is stored
+*self: The class to check
+*parent: The class that 'self' may inherit from
+
+Errors:
+    ErrInvalidParameters: Thrown if 'result', 'self' or 'parent' is set to NULL
+    ErrOutOfMemory: Thrown if there is not enough memory to number the classes
+*/
+inst_error_t *is_subclass_of(prog_hand_t *prog_handler, bool *result, class_t *self,
+        class_t *parent);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,67 @@
+/*
+Field Handle
+By Ciaran Gruber
+
+The Field Handle is a handle for a member field that is resolved once for a class and field name.
+Inherited member fields keep the same slot in every subclass so the handle can get the member field
+from instances of the class and its subclasses without comparing the name of each member field
+
+File-specific:
+Field Handle - Code File
+The code used to provide for the implementation of a Field Handle
+*/
+
+#include "field_handle.h"
+#include "../class/class.h"
+#include "../variable/variable.h"
+#include "../variable/var_description.h"
+#include "../../program-handlers/error-handler/error_handler.h"
+
+void free_field_handle(field_handle_t *src) {
+    if (src == NULL) return;
+
+    free_var_desc(src->desc);
+    free(src);
+}
+
+inst_error_t *new_field_handle(prog_hand_t *prog_handler, field_handle_t *dest, class_t *class,
+        char *field_name) {
+    inst_error_t *error;
+    if (dest == NULL || class == NULL || field_name == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    // Resolve the slot once so that no names are compared when the handle is used
+    int slot;
+    error = get_field_slot(prog_handler, class, &slot, field_name);
+    if (error != NULL) return error;
+
+    dest->class = class;
+    dest->slot = slot;
+    // Keep the description alive so that its memory can not be reused by another member field
+    dest->desc = class->field_layout[slot];
+    retain_var_desc(dest->desc);
+    return NULL;
+}
+
+inst_error_t *get_member_field_h(prog_hand_t *prog_handler, var_t *self, var_t **dest,
+        field_handle_t *handle) {
+    if (self == NULL || dest == NULL || handle == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    // Produce error if variable's data is not managed
+    if (!var_type(prog_handler, self)->has_managed_data) {
+        return new_error(prog_handler, "ErrInvalidDataFormat");
+    }
+
+    // Subclasses share the description of an inherited member field in the same slot, so any other
+    // description means the instance is of an unrelated class or was created with an older layout
+    inst_fields_t *fields = (inst_fields_t *)self->data;
+    if (fields == NULL || handle->slot >= fields->field_count ||
+            fields->fields[handle->slot].desc != handle->desc) {
+        return new_error(prog_handler, "ErrVariableNotDefined");
+    }
+    *dest = &(fields->fields[handle->slot]);
+    return NULL;
+}
\ No newline at end of file
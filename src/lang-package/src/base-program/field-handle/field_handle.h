@@ -0,0 +1,61 @@
+/*
+Field Handle
+By Ciaran Gruber
+
+The Field Handle is a handle for a member field that is resolved once for a class and field name.
+Inherited member fields keep the same slot in every subclass so the handle can get the member field
+from instances of the class and its subclasses without comparing the name of each member field
+
+File-specific:
+Field Handle - Header File
+The structures used to represent a Field Handle
+*/
+
+#ifndef FIELD_HANDLE
+#define FIELD_HANDLE
+
+#include "../../typedefs.h"
+
+/*
+Frees the memory occupied by a Field Handle structure, releasing its reference to the description
+of the member field. The class is owned by the Class Handler and is not freed
+
+*src: The Field Handle structure whose memory is to be freed
+*/
+void free_field_handle(field_handle_t *src);
+
+/*
+Creates a new Field Handle for the member field with the given name in instances of a class
+
+*prog_handler: The program handler that contains the class and error handlers
+*dest: A pointer to where the Field Handle structure will be stored
+*class: The class that has the member field
+*field_name: The name of the member field
+
+Errors:
+    ErrInvalidParameters: Thrown if 'dest', 'class' or 'field_name' is set to NULL
+    ErrInvalidDataFormat: Thrown if the class does not use managed data
+    ErrVariableNotDefined: Thrown if the given member field does not exist
+*/
+inst_error_t *new_field_handle(prog_hand_t *prog_handler, field_handle_t *dest, class_t *class,
+        char *field_name);
+
+/*
+Gets a member field from a variable using a Field Handle. This takes constant time and works for
+instances of the class the handle was created for as well as any of its subclasses
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The variable to get a member field from
+**dest: The location to store the retrieved member field to
+*handle: The Field Handle of the member field
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self', 'dest' or 'handle' is set to NULL
+    ErrInvalidDataFormat: Thrown when the class of the variable does not use managed data
+    ErrVariableNotDefined: Thrown when the variable does not have the member field, such as when it
+                           is not an instance of the class of the handle
+*/
+inst_error_t *get_member_field_h(prog_hand_t *prog_handler, var_t *self, var_t **dest,
+        field_handle_t *handle);
+
+#endif
\ No newline at end of file
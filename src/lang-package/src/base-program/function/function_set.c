@@ -14,6 +14,8 @@ The code used to provide for the implementation of a Function Set
 #include "function_set.h"
 #include "function.h"
 #include "../../program-handlers/error-handler/error_handler.h"
+#include "../../program-handlers/selector-handler/selector_handler.h"
+#include "../../program-handlers/metadata-arena/meta_arena.h"
 
 static void __get_prev_node(prog_hand_t *prog_handler, function_set_t *self, bool *funct_exists,
         funct_node_t **prev_node, class_t **param_types, int param_count);
@@ -24,16 +26,12 @@ static void __get_node(prog_hand_t *prog_handler, function_set_t *self, funct_no
 void free_funct_set(function_set_t *src) {
     if (src == NULL) return;
 
-    free(src->name);
-    // Free individual functions
-    funct_node_t *next, *curr = src->first;
+    // Free individual functions as the set and its nodes are held in the Metadata Arena
+    funct_node_t *curr = src->first;
     while (curr != NULL) {
-        next = curr->next;
         free_function(curr->function);
-        free(curr);
-        curr = next;
+        curr = curr->next;
     }
-    free(src);
 }
 
 inst_error_t *new_funct_set(prog_hand_t *prog_handler, function_set_t *dest, char *name) {
@@ -43,12 +41,12 @@ inst_error_t *new_funct_set(prog_hand_t *prog_handler, function_set_t *dest, cha
     }
 
     dest->first = NULL;
-    // Copy name of function set
-    dest->name = (char *)malloc(strlen(name)*sizeof(char));
-    if (dest->name == NULL) {
-        return new_error(prog_handler, "ErrOutOfMemory");
-    }
-    strcpy(dest->name, name);
+    // Use the interned name which is shared with the functions in the set
+    int selector;
+    error = get_selector(prog_handler, &selector, name);
+    if (error != NULL) return error;
+    error = get_selector_name(prog_handler, &(dest->name), selector);
+    if (error != NULL) return error;
 
     return NULL;
 }
@@ -75,7 +73,10 @@ inst_error_t *fset_add_function(prog_hand_t *prog_handler, function_set_t *self,
     }
 
     // Add function to start
-    funct_node_t *function_node = (funct_node_t *)malloc(sizeof(funct_node_t));
+    funct_node_t *function_node = (funct_node_t *)arena_alloc(prog_handler, sizeof(funct_node_t));
+    if (function_node == NULL) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
     function_node->function = function;
     function_node->next = self->first;
     self->first = function_node;
@@ -106,13 +107,13 @@ inst_error_t *fset_remove(prog_hand_t *prog_handler, function_set_t *self,
 
     // Remove the function and free memory
     if (curr->function != NULL) {
-        if (self->first) { // Function is first
+        if (prev == NULL) { // Function is first
             self->first = curr->next;
         } else { // Function is in the middle
             prev->next = curr->next;
         }
+        // The node is held in the Metadata Arena until the program handler is freed
         free_function(curr->function);
-        free(curr);
     }
 
     return NULL;
@@ -125,15 +126,31 @@ inst_error_t *fset_get_function(prog_hand_t *prog_handler, function_set_t *self,
         return new_error(prog_handler, "ErrInvalidParameters");
     }
 
+    // Attempt to get function
+    bool found;
+    error = fset_try_get_function(prog_handler, self, &found, dest, param_types, param_count);
+    if (error != NULL) return error;
+    if (!found) {
+        return new_error(prog_handler, "ErrFunctionNotDefined");
+    }
+    return NULL;
+}
+
+inst_error_t *fset_try_get_function(prog_hand_t *prog_handler, function_set_t *self, bool *found,
+        function_t **dest, class_t **param_types, int param_count) {
+    if (self == NULL || found == NULL || dest == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
     // Attempt to get function node
     funct_node_t *node;
     __get_node(prog_handler, self, &node, param_types, param_count);
-    if (node == NULL) {
-        return new_error(prog_handler, "ErrFunctionNotDefined");
-    }
+    *found = node != NULL;
 
     // Set Function
-    *dest = node->function;
+    if (*found) {
+        *dest = node->function;
+    }
     return NULL;
 }
 
@@ -151,7 +168,7 @@ inst_error_t *fset_function_exists(prog_hand_t *prog_handler, function_set_t *se
 static void __get_prev_node(prog_hand_t *prog_handler, function_set_t *self, bool *funct_exists,
         funct_node_t **prev_node, class_t **param_types, int param_count) {
     funct_node_t *curr = self->first;
-    *prev_node = NULL;
+    if (prev_node != NULL) *prev_node = NULL;
     // Loop through available functions
     while(curr != NULL) {
         // Check if the function in the node is equal - If it exists leave prev_node as is
@@ -13,12 +13,18 @@ The code used to provide for the implementation of a Static Function
 #include <string.h>
 #include "static_function.h"
 #include "../../program-handlers/error-handler/error_handler.h"
+#include "../../program-handlers/selector-handler/selector_handler.h"
+#include "../../program-handlers/metadata-arena/meta_arena.h"
+#include "../class/class.h"
+#include "../variable/variable.h"
+
+static inst_error_t *__is_param_type(prog_hand_t *prog_handler, bool *result, class_t *arg_type,
+        class_t *param_type);
 
 void free_s_function(s_function_t *src) {
     if (src == NULL) return;
 
-    free(src->name);
-    free(src->param_types);
+    // The name is interned and the parameter types are held in the Metadata Arena
     free(src);
 }
 
@@ -30,18 +36,23 @@ inst_error_t *new_s_function(prog_hand_t *prog_handler, s_function_t *dest, char
         return new_error(prog_handler, "ErrInvalidParameters");
     }
 
-    // Copy name
-    dest->name = (char *)malloc(strlen(name)*sizeof(char));
-    if (dest->name == NULL) {
-        return new_error(prog_handler, "ErrOutOfMemory");
-    }
+    // Intern name so that the function can be found by selector and use the interned copy
+    error = get_selector(prog_handler, &(dest->selector), name);
+    if (error != NULL) return error;
+    error = get_selector_name(prog_handler, &(dest->name), dest->selector);
+    if (error != NULL) return error;
     // Copy passed values
     dest->function = function;
     dest->return_type = return_type;
-    // Copy parameter types
-    dest->param_types = (class_t **)malloc(param_count*sizeof(class_t *));
-    if (dest->param_types == NULL) {
-        return new_error(prog_handler, "ErrOutOfMemory");
+    // Copy parameter types into the Metadata Arena as they last as long as the class
+    dest->param_types = NULL;
+    if (param_count > 0) {
+        dest->param_types = (class_t **)arena_alloc(prog_handler,
+                                                    param_count*sizeof(class_t *));
+        if (dest->param_types == NULL) {
+            return new_error(prog_handler, "ErrOutOfMemory");
+        }
+        memcpy(dest->param_types, param_types, param_count*sizeof(class_t *));
     }
     dest->param_count = param_count;
 
@@ -60,20 +71,21 @@ inst_error_t *s_function_run(prog_hand_t *prog_handler, s_function_t *self, var_
         return new_error(prog_handler, "ErrInvalidParameters");
     }
     // Check variable types
+    bool is_valid;
     for (int i = 0; i < param_count; i++) {
-        class_t *curr_class = params[i]->desc->type;
-        // Loop through to see if the variable is a child of a suitable class
-        while (curr_class != NULL || !curr_class->has_managed_data) {
-            if (curr_class == self->param_types[i]) {
-                break;
-            }
-            curr_class = curr_class->parent;
-        }
+        error = __is_param_type(prog_handler, &is_valid, var_type(prog_handler, params[i]),
+                                self->param_types[i]);
+        if (error != NULL) return error;
         // Suitable class was not found
-        if (curr_class == NULL) {
+        if (!is_valid) {
             return new_error(prog_handler, "ErrInvalidParameters");
         }
     }
+    // A shared return variable can not be changed as every holder of a reference would see the value
+    if (return_val != NULL && atomic_load_explicit(&(return_val->ref_count),
+                                                   memory_order_relaxed) > 1) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
     // Run function and handle any errors
     error = self->function(prog_handler, return_val, params);
     return error;
@@ -93,24 +105,35 @@ inst_error_t *is_s_function_equal(prog_hand_t *prog_handler, bool *result, s_fun
     }
 
     // Check parameters
-    class_t *curr_class;
     for (int i = 0; i < param_count; i++) {
-        curr_class = param_types[i];
-        // Loop through to see if the variable is a child of a suitable class
-        while (curr_class != NULL || !curr_class->has_managed_data) {
-            if (curr_class == param_types[i]) {
-                break;
-            }
-            curr_class = curr_class->parent;
-        }
-        // If parameter is not the same, function is not the same
-        if (curr_class != param_types[i]) {
-            *result = false;
-            return NULL;
-        }
+        error = __is_param_type(prog_handler, result, param_types[i], self->param_types[i]);
+        if (error != NULL) return error;
+        // If parameter is not suitable, function is not the same
+        if (!*result) return NULL;
     }
 
     // Return that they are the same
     *result = true;
     return NULL;
+}
+
+/*
+Checks whether a variable of the given class may be passed as a parameter of the given type. Only
+classes with managed data may be passed in place of a class they inherit from
+
+*prog_handler: The program handler that contains the class and error handlers
+*result: A pointer to the boolean where the result is stored
+*arg_type: The class of the variable being passed
+*param_type: The class of the parameter
+
+Errors:
+    ErrOutOfMemory: Thrown if there is not enough memory to number the classes
+*/
+static inst_error_t *__is_param_type(prog_hand_t *prog_handler, bool *result, class_t *arg_type,
+        class_t *param_type) {
+    *result = arg_type == param_type;
+    if (*result || arg_type == NULL || param_type == NULL || !arg_type->has_managed_data) {
+        return NULL;
+    }
+    return is_subclass_of(prog_handler, result, arg_type, param_type);
 }
\ No newline at end of file
@@ -16,7 +16,8 @@ The structures used to represent the Static Function
 #include "../../typedefs.h"
 
 /*
-Frees the memory occupied by a Static Function structure
+Frees the memory occupied by a Static Function structure. Its name is interned and its parameter
+types are held in the Metadata Arena so they are freed along with the program handler
 
 *src: The Static Function structure whose memory is to be freed 
 */
@@ -47,7 +48,9 @@ Runs a given function, storing the returned values and any errors
 
 *prog_handler: The program handler that contains the class and error handlers
 *self: The function that is to be run
-*return_val: The variable in which to store the returned value - Note memory must be pre-allocated
+*return_val: The variable in which to store the returned value - Note memory must be pre-allocated.
+             The value is written into the variable rather than handing back a new reference, so
+             the variable must not be shared with another reference
 **params: A lsit of parameters to pass into the function
 param_count: The number of parameters that ahve been passed into the function
 
@@ -55,8 +58,9 @@ Returns: A variable depending on the function that is run
 
 Errors: Returns any error run by the function as well as the possible following errors
     ErrInvalidParameters: Thrown if: 
-                          'self' is set to NULL; or 
-                          the parameters do not match the function
+                          'self' is set to NULL; 
+                          the parameters do not match the function; or
+                          'return_val' has been retained and is shared with another reference
 */
 inst_error_t *s_function_run(prog_hand_t *prog_handler, s_function_t *self, var_t *return_val,
         var_t **params, int param_count);
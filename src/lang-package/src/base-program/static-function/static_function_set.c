@@ -14,6 +14,8 @@ The code used to provide for the implementation of a Static Function Set
 #include "static_function_set.h"
 #include "static_function.h"
 #include "../../program-handlers/error-handler/error_handler.h"
+#include "../../program-handlers/selector-handler/selector_handler.h"
+#include "../../program-handlers/metadata-arena/meta_arena.h"
 
 static void __get_prev_node(prog_hand_t *prog_handler, s_function_set_t *self, bool *funct_exists,
         s_funct_node_t **prev_node, class_t **param_types, int param_count);
@@ -24,16 +26,12 @@ static void __get_node(prog_hand_t *prog_handler, s_function_set_t *self, s_func
 void free_s_funct_set(s_function_set_t *src) {
     if (src == NULL) return;
 
-    free(src->name);
-    // Free individual functions
-    s_funct_node_t *next, *curr = src->first;
+    // Free individual functions as the set and its nodes are held in the Metadata Arena
+    s_funct_node_t *curr = src->first;
     while (curr != NULL) {
-        next = curr->next;
         free_s_function(curr->function);
-        free(curr);
-        curr = next;
+        curr = curr->next;
     }
-    free(src);
 }
 
 inst_error_t *new_s_funct_set(prog_hand_t *prog_handler, s_function_set_t *dest, char *name) {
@@ -43,12 +41,12 @@ inst_error_t *new_s_funct_set(prog_hand_t *prog_handler, s_function_set_t *dest,
     }
 
     dest->first = NULL;
-    // Copy name of function set
-    dest->name = (char *)malloc(strlen(name)*sizeof(char));
-    if (dest->name == NULL) {
-        return new_error(prog_handler, "ErrOutOfMemory");
-    }
-    strcpy(dest->name, name);
+    // Use the interned name which is shared with the functions in the set
+    int selector;
+    error = get_selector(prog_handler, &selector, name);
+    if (error != NULL) return error;
+    error = get_selector_name(prog_handler, &(dest->name), selector);
+    if (error != NULL) return error;
 
     return NULL;
 }
@@ -75,7 +73,11 @@ inst_error_t *sfset_add_function(prog_hand_t *prog_handler, s_function_set_t *se
     }
 
     // Add function to start
-    s_funct_node_t *function_node = (s_funct_node_t *)malloc(sizeof(s_funct_node_t));
+    s_funct_node_t *function_node = (s_funct_node_t *)arena_alloc(prog_handler,
+                                                                  sizeof(s_funct_node_t));
+    if (function_node == NULL) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
     function_node->function = function;
     function_node->next = self->first;
     self->first = function_node;
@@ -106,13 +108,13 @@ inst_error_t *sfset_remove(prog_hand_t *prog_handler, s_function_set_t *self,
 
     // Remove the function and free memory
     if (curr->function != NULL) {
-        if (self->first) { // Function is first
+        if (prev == NULL) { // Function is first
             self->first = curr->next;
         } else { // Function is in the middle
             prev->next = curr->next;
         }
+        // The node is held in the Metadata Arena until the program handler is freed
         free_s_function(curr->function);
-        free(curr);
     }
 
     return NULL;
@@ -125,15 +127,31 @@ inst_error_t *sfset_get_function(prog_hand_t *prog_handler, s_function_set_t *se
         return new_error(prog_handler, "ErrInvalidParameters");
     }
 
+    // Attempt to get function
+    bool found;
+    error = sfset_try_get_function(prog_handler, self, &found, dest, param_types, param_count);
+    if (error != NULL) return error;
+    if (!found) {
+        return new_error(prog_handler, "ErrFunctionNotDefined");
+    }
+    return NULL;
+}
+
+inst_error_t *sfset_try_get_function(prog_hand_t *prog_handler, s_function_set_t *self,
+        bool *found, s_function_t **dest, class_t **param_types, int param_count) {
+    if (self == NULL || found == NULL || dest == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
     // Attempt to get function node
     s_funct_node_t *node;
     __get_node(prog_handler, self, &node, param_types, param_count);
-    if (node == NULL) {
-        return new_error(prog_handler, "ErrFunctionNotDefined");
-    }
+    *found = node != NULL;
 
     // Set Function
-    *dest = node->function;
+    if (*found) {
+        *dest = node->function;
+    }
     return NULL;
 }
 
@@ -151,7 +169,7 @@ inst_error_t *sfset_function_exists(prog_hand_t *prog_handler, s_function_set_t
 static void __get_prev_node(prog_hand_t *prog_handler, s_function_set_t *self, bool *funct_exists,
         s_funct_node_t **prev_node, class_t **param_types, int param_count) {
     s_funct_node_t *curr = self->first;
-    *prev_node = NULL;
+    if (prev_node != NULL) *prev_node = NULL;
     // Loop through available functions
     while(curr != NULL) {
         // Check if the function in the node is equal - If it exists leave prev_node as is
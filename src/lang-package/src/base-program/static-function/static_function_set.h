@@ -30,7 +30,8 @@ struct gen_s_function_set {
 };
 
 /*
-Frees the memory occupuied by a Static Function Set structure
+Frees the Functions within a Static Function Set structure. The set and its nodes are held in the
+Metadata Arena and are freed along with the program handler
 
 *src: The Static Function Set structure whose memory is to be freed 
 */
@@ -97,6 +98,23 @@ Errors:
 inst_error_t *sfset_get_function(prog_hand_t *prog_handler, s_function_set_t *self, 
         s_function_t **dest, class_t **param_types, int param_count);
 
+/*
+Gets a function from the set based upon the parameters without throwing an error if the function
+could not be found
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The Static Function Set to get the function from
+*found: A boolean value representing whether the function was found
+**dest: A pointer to the function which is only set if the function was found
+**param_types: The parameters used within the function
+param_count: The number of parameters used by the function
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self', 'found' or 'dest' is set to NULL
+*/
+inst_error_t *sfset_try_get_function(prog_hand_t *prog_handler, s_function_set_t *self,
+        bool *found, s_function_t **dest, class_t **param_types, int param_count);
+
 /*
 Returns whether the function exists and if it does, returns a reference to the node before that
 function
@@ -14,12 +14,23 @@ The code used to provide for the implementation of a Variable
 #include "var_description.h"
 #include "../../program-handlers/class-handler/class_handler.h"
 #include "../../program-handlers/error-handler/error_handler.h"
+#include "../../program-handlers/variable-pool/var_pool.h"
 
 void free_var_desc(var_desc_t *src) {
     if (src == NULL) return;
 
-    free(src->name);
-    free(src);
+    // Every use of the description by other threads must happen before the last release frees it
+    if (atomic_fetch_sub_explicit(&(src->ref_count), 1, memory_order_acq_rel) > 1) return;
+    if (src->owns_name) {
+        pool_free(src->name);
+    }
+    pool_free(src);
+}
+
+void retain_var_desc(var_desc_t *src) {
+    if (src == NULL) return;
+
+    atomic_fetch_add_explicit(&(src->ref_count), 1, memory_order_relaxed);
 }
 
 inst_error_t *new_var_desc(prog_hand_t *prog_handler, var_desc_t *dest) {
@@ -29,7 +40,9 @@ inst_error_t *new_var_desc(prog_hand_t *prog_handler, var_desc_t *dest) {
 
     dest->initialised = false;
     dest->name = NULL;
+    dest->owns_name = false;
     dest->type = NULL;
+    atomic_init(&(dest->ref_count), 1);
     return NULL;
 }
 
@@ -39,21 +52,21 @@ inst_error_t *init_var_desc(prog_hand_t *prog_handler, var_desc_t *dest, char *t
         return new_error(prog_handler, "ErrInvalidParameters");
     }
 
-    // Free any existing memory
-    if (dest->initialised) {
-        free(dest->name);
-    }
-
     // Get class
     error = get_class(prog_handler, &(dest->type), type);
     if (error != NULL) return error;
 
-    // Copy name
-    dest->name = (char *)malloc(strlen(name)*sizeof(char));
-    if (dest->name == NULL) {
+    // Copy name before freeing the existing name as they may be the same string
+    char *new_name = (char *)pool_alloc(prog_handler, (strlen(name) + 1)*sizeof(char));
+    if (new_name == NULL) {
         return new_error(prog_handler, "ErrOutOfMemory");
     }
-    strcpy(dest->name, name);
+    strcpy(new_name, name);
+    if (dest->owns_name) {
+        pool_free(dest->name);
+    }
+    dest->name = new_name;
+    dest->owns_name = true;
 
     // Set initialisation value
     dest->initialised = true;
@@ -16,14 +16,24 @@ The structures used to describe a uninitialised variable
 #include "../../typedefs.h"
 
 /*
-Frees the memory occupuied by a Variable Description structure
+Releases a reference to a Variable Description structure, freeing the memory it occupies once no
+references remain. The name is freed with the description if it was copied for it
 
 *src: The Variable structure whose memory is to be freed
 */
 void free_var_desc(var_desc_t *src);
 
 /*
-Creates a template for a new variable description by setting the relevant details to default values
+Adds a reference to a Variable Description structure so that it is not freed until the reference is
+released with free_var_desc
+
+*src: The Variable Description structure to reference
+*/
+void retain_var_desc(var_desc_t *src);
+
+/*
+Creates a template for a new variable description by setting the relevant details to default values.
+The description starts with a single reference
 
 *dest: The Variable Description that is to be reset
 
@@ -11,11 +11,15 @@ The code used to provide for the implementation of a Variable
 
 #include <string.h>
 #include "variable.h"
+#include "../../program-handlers/program-handler/program_handler.h"
 #include "../../program-handlers/class-handler/class_handler.h"
 #include "../../program-handlers/error-handler/error_handler.h"
 #include "../../program-handlers/function-handler/function_handler.h"
 #include "../../program-handlers/variable-handler/variable_handler.h"
+#include "../../program-handlers/selector-handler/selector_handler.h"
+#include "../../program-handlers/variable-pool/var_pool.h"
 #include "../../types/Object/t_Object.h"
+#include "../../types/type_creator.h"
 #include "var_description.h"
 #include "../function/function.h"
 #include "../class/class.h"
@@ -25,13 +29,100 @@ static inst_error_t *__get_function(prog_hand_t *prog_handler, function_t **dest
 static inst_error_t *__convert_super(prog_hand_t *prog_handler, class_t *self,
         class_t **super_class, int parent_levels);
 
-// ################### MUST BE ADJUSTED TO INCORPORATE MEMBER FIELDS #######################
 void free_var(var_t *src) {
     if (src == NULL) return;
 
-    free(src->data);
+    free_var_data(src);
+    // The structure holding an embedded variable frees its memory and releases its description
+    if (src->embedded) {
+        src->initialised = false;
+        return;
+    }
+    free_var_desc(src->desc);
+    if (src->pooled) {
+        pool_free(src);
+    } else {
+        free(src);
+    }
+}
+
+void retain_var(var_t *src) {
+    // Embedded variables last as long as the structure holding them so they are not counted
+    if (src == NULL || src->embedded) return;
+
+    // Only a single thread uses the variable so the count does not need to be changed atomically
+    int count = atomic_load_explicit(&(src->ref_count), memory_order_relaxed);
+    atomic_store_explicit(&(src->ref_count), count + 1, memory_order_relaxed);
+}
+
+void release_var(var_t *src) {
+    if (src == NULL || src->embedded) return;
+
+    int count = atomic_load_explicit(&(src->ref_count), memory_order_relaxed) - 1;
+    atomic_store_explicit(&(src->ref_count), count, memory_order_relaxed);
+    if (count == 0) {
+        free_var(src);
+    }
+}
+
+void retain_var_atomic(var_t *src) {
+    if (src == NULL || src->embedded) return;
+
+    // A new reference can only be made from an existing one so no ordering is needed
+    atomic_fetch_add_explicit(&(src->ref_count), 1, memory_order_relaxed);
+}
+
+void release_var_atomic(var_t *src) {
+    if (src == NULL || src->embedded) return;
+
+    // Every use of the variable by other threads must happen before the last release frees it
+    if (atomic_fetch_sub_explicit(&(src->ref_count), 1, memory_order_acq_rel) == 1) {
+        free_var(src);
+    }
+}
+
+void free_var_data(var_t *src) {
+    if (src == NULL) return;
+    // Data stored within the variable has no memory to free
+    if (src->inline_data) {
+        src->inline_data = false;
+        src->data = NULL;
+        return;
+    }
+    if (src->data == NULL) return;
+
+    if (src->desc != NULL && src->desc->type != NULL && src->desc->type->has_managed_data) {
+        free_inst_fields((inst_fields_t *)src->data);
+    } else {
+        pool_free(src->data);
+    }
+    src->data = NULL;
+}
+
+void free_inst_fields(inst_fields_t *src) {
+    if (src == NULL) return;
+
+    // Member fields are stored in a single block allocated from the Variable Pool and release the
+    // descriptions they share with the field layout of their class
+    for (int i = 0; i < src->field_count; i++) {
+        free_var_data(&(src->fields[i]));
+        free_var_desc(src->fields[i].desc);
+    }
+    // A block within a region is kept until the region ends so it must not be released twice
+    src->field_count = 0;
+    pool_free(src);
+}
+
+void free_var_array(var_array_t *src) {
+    if (src == NULL) return;
+
+    // Member field blocks within the array are left in place when the data of an instance is freed
+    for (int i = 0; i < src->count; i++) {
+        free_var_data(&(src->vars[i]));
+        free_var_desc(src->vars[i].desc);
+    }
     free_var_desc(src->desc);
-    free(src);
+    pool_free(src);
 }
 
 inst_error_t *new_var(prog_hand_t *prog_handler, var_t *dest) {
@@ -40,13 +131,87 @@ inst_error_t *new_var(prog_hand_t *prog_handler, var_t *dest) {
     }
 
     dest->initialised = false;
+    dest->pooled = false;
+    dest->embedded = false;
+    dest->inline_data = false;
+    dest->gc_flags = 0;
+    dest->imm_tag = IMM_NONE;
+    atomic_init(&(dest->ref_count), 1);
     dest->data = NULL;
-    dest->desc = (var_desc_t *)malloc(sizeof(var_desc_t));
-    new_var_desc(prog_handler, dest->desc);
+    dest->desc = (var_desc_t *)pool_alloc(prog_handler, sizeof(var_desc_t));
+    if (dest->desc == NULL) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+    return new_var_desc(prog_handler, dest->desc);
+}
+
+inst_error_t *new_pooled_var(prog_hand_t *prog_handler, var_t **dest) {
+    inst_error_t *error;
+    if (dest == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    var_t *var = (var_t *)pool_alloc(prog_handler, sizeof(var_t));
+    if (var == NULL) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+    error = new_var(prog_handler, var);
+    if (error != NULL) {
+        pool_free(var);
+        return error;
+    }
+    // Mark the variable so that free_var returns it to the pool
+    var->pooled = true;
+    *dest = var;
+    return NULL;
+}
+
+inst_error_t *new_immediate(prog_hand_t *prog_handler, var_t *dest, int tag, void *data) {
+    if (dest == NULL || tag <= IMM_NONE || tag >= IMM_TAG_COUNT) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+    class_t *class = prog_handler->imm_classes[tag];
+    if (class == NULL) {
+        return new_error(prog_handler, "ErrClassNotDefined");
+    }
+
+    dest->desc = NULL;
+    dest->data = NULL;
+    dest->initialised = true;
+    dest->pooled = false;
+    dest->embedded = false;
+    dest->inline_data = true;
+    dest->gc_flags = 0;
+    dest->imm_tag = tag;
+    atomic_init(&(dest->ref_count), 1);
+    if (data != NULL) {
+        memcpy(&(dest->data), data, class->size);
+    }
+    return NULL;
+}
+
+class_t *var_type(prog_hand_t *prog_handler, var_t *var) {
+    // Immediates have no description so their class is found from their tag
+    if (var->desc == NULL) {
+        return prog_handler->imm_classes[var->imm_tag];
+    }
+    return var->desc->type;
+}
+
+inst_error_t *get_array_var(prog_hand_t *prog_handler, var_array_t *self, var_t **dest, int index) {
+    if (self == NULL || dest == NULL || index < 0 || index >= self->count) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+    *dest = &(self->vars[index]);
+    return NULL;
 }
 
 inst_error_t *set_var_desc(prog_hand_t *prog_handler, var_t *dest, char *type, char *name) {
     inst_error_t *error;
+    // Immediates have no description to set
+    if (dest->desc == NULL) {
+        return new_error(prog_handler, "ErrInvalidDataFormat");
+    }
     // Reset values if necessary
     if (dest->initialised) {
         if (strcmp(dest->desc->type->class_name, type)) {
@@ -54,6 +219,23 @@ inst_error_t *set_var_desc(prog_hand_t *prog_handler, var_t *dest, char *type, c
             if (error != NULL) return error;
         }
     }
+
+    // Shared descriptions such as those of member fields must not be changed so a new one is made
+    if (atomic_load_explicit(&(dest->desc->ref_count), memory_order_relaxed) > 1) {
+        var_desc_t *desc = (var_desc_t *)pool_alloc(prog_handler, sizeof(var_desc_t));
+        if (desc == NULL) {
+            return new_error(prog_handler, "ErrOutOfMemory");
+        }
+        new_var_desc(prog_handler, desc);
+        error = init_var_desc(prog_handler, desc, type, name);
+        if (error != NULL) {
+            free_var_desc(desc);
+            return error;
+        }
+        free_var_desc(dest->desc);
+        dest->desc = desc;
+        return NULL;
+    }
     error = init_var_desc(prog_handler, dest->desc, type, name);
     return error;
 }
@@ -63,18 +245,29 @@ inst_error_t *init_var_exact(prog_hand_t *prog_handler, var_t *dest, void *data)
     if (dest == NULL) {
         return new_error(prog_handler, "ErrInvalidParameters");
     }
-    if (dest->desc->type->has_managed_data) {
+    class_t *class = var_type(prog_handler, dest);
+    if (class->has_managed_data) {
         return new_error(prog_handler, "ErrInvalidDataFormat");
     }
 
-    // Copy data
-    dest->data = (void *)malloc(dest->desc->type->size);
-    if (dest->data == NULL) {
-        return new_error(prog_handler, "ErrOutOfMemory");
+    // Free any existing data so that it can be replaced
+    free_var_data(dest);
+
+    // Copy data into the variable itself if it fits, otherwise into memory from the pool
+    size_t size = class->size;
+    void *bytes = &(dest->data);
+    if (size <= MAX_INLINE_DATA) {
+        dest->inline_data = true;
+    } else {
+        dest->data = pool_alloc(prog_handler, size);
+        if (dest->data == NULL) {
+            return new_error(prog_handler, "ErrOutOfMemory");
+        }
+        bytes = dest->data;
     }
     // If given data is NULL, leave data blank
     if (data != NULL) {
-        memcpy(dest->data, data, dest->desc->type->size);
+        memcpy(bytes, data, size);
     }
 
     dest->initialised = true;
@@ -88,15 +281,44 @@ inst_error_t *run_function(prog_hand_t *prog_handler, var_t *self, char *funct_n
         return new_error(prog_handler, "ErrInvalidParameters");
     }
 
-    // Convert parameter types
-    class_t **param_types = (class_t **)malloc(param_count*sizeof(class_t *));
+    // A function can not exist if its name has never been interned
+    bool sel_exists;
+    int selector;
+    error = selector_exists(prog_handler, &sel_exists, &selector, funct_name);
+    if (error != NULL) return error;
+    if (!sel_exists) {
+        return new_error(prog_handler, "ErrFunctionNotDefined");
+    }
+
+    return run_function_sel(prog_handler, self, selector, return_var, params, param_count);
+}
+
+inst_error_t *run_function_sel(prog_hand_t *prog_handler, var_t *self, int selector,
+        var_t *return_var, var_t **params, int param_count) {
+    inst_error_t *error;
+    if (self == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    // Convert parameter types, only allocating if there are too many to store on the stack
+    class_t *stack_types[MAX_STACK_PARAMS];
+    class_t **param_types = stack_types;
+    if (param_count > MAX_STACK_PARAMS) {
+        param_types = (class_t **)malloc(param_count*sizeof(class_t *));
+        if (param_types == NULL) {
+            return new_error(prog_handler, "ErrOutOfMemory");
+        }
+    }
     for (int i = 0; i < param_count; i++) {
-        param_types[i] = params[i]->desc->type;
+        param_types[i] = var_type(prog_handler, params[i]);
     }
 
     function_t *function;
-    error = __get_function(prog_handler, &function, self->desc->type, funct_name, param_types,
-                            param_count);
+    error = get_function_sel(prog_handler, var_type(prog_handler, self), &function, selector,
+                             param_types, param_count);
+    if (param_types != stack_types) {
+        free(param_types);
+    }
     if (error != NULL) return error;
     error = function_run(prog_handler, function, self, return_var, params, param_count);
     return error;
@@ -109,18 +331,29 @@ inst_error_t *run_super_function(prog_hand_t *prog_handler, var_t *self, char *f
         return new_error(prog_handler, "ErrInvalidParameters");
     }
 
-    // Convert parameter types
-    class_t **param_types = (class_t **)malloc(param_count*sizeof(class_t *));
-    for (int i = 0; i < param_count; i++) {
-        param_types[i] = params[i]->desc->type;
-    }
-
     function_t *function;
-    class_t *var_class = self->desc->type;
+    class_t *var_class = var_type(prog_handler, self);
     error = __convert_super(prog_handler, var_class, &var_class, parent_levels);
     if (error != NULL) return error;
+
+    // Convert parameter types, only allocating if there are too many to store on the stack
+    class_t *stack_types[MAX_STACK_PARAMS];
+    class_t **param_types = stack_types;
+    if (param_count > MAX_STACK_PARAMS) {
+        param_types = (class_t **)malloc(param_count*sizeof(class_t *));
+        if (param_types == NULL) {
+            return new_error(prog_handler, "ErrOutOfMemory");
+        }
+    }
+    for (int i = 0; i < param_count; i++) {
+        param_types[i] = var_type(prog_handler, params[i]);
+    }
+
     error = __get_function(prog_handler, &function, var_class, funct_name, param_types,
                             param_count);
+    if (param_types != stack_types) {
+        free(param_types);
+    }
     if (error != NULL) return error;
     error = function_run(prog_handler, function, self, return_var, params, param_count);
     return error;
@@ -128,20 +361,46 @@ inst_error_t *run_super_function(prog_hand_t *prog_handler, var_t *self, char *f
 
 inst_error_t *get_member_field(prog_hand_t *prog_handler, var_t *self, var_t **dest, 
         char *field_name) {
-    inst_error_t *error;
     if (self == NULL || dest == NULL || field_name == NULL) {
         return new_error(prog_handler, "ErrInvalidParameters");
     }
 
-    // Produce error if variable's data is not managed with a Variable Handler
-    if (!self->desc->type->has_managed_data) {
+    // Produce error if variable's data is not managed
+    if (!var_type(prog_handler, self)->has_managed_data) {
         return new_error(prog_handler, "ErrInvalidDataFormat");
     }
     
-    // Get member field
-    var_hand_t *var_handler = (var_hand_t *)self->data;
-    error = get_var(prog_handler, var_handler, dest, field_name);
-    return error;
+    // Find the slot of the member field within the instance
+    inst_fields_t *fields = (inst_fields_t *)self->data;
+    if (fields != NULL) {
+        for (int i = 0; i < fields->field_count; i++) {
+            if (!strcmp(fields->fields[i].desc->name, field_name)) {
+                *dest = &(fields->fields[i]);
+                return NULL;
+            }
+        }
+    }
+    return new_error(prog_handler, "ErrVariableNotDefined");
+}
+
+inst_error_t *get_member_field_slot(prog_hand_t *prog_handler, var_t *self, var_t **dest,
+        int slot) {
+    if (self == NULL || dest == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    // Produce error if variable's data is not managed
+    if (!var_type(prog_handler, self)->has_managed_data) {
+        return new_error(prog_handler, "ErrInvalidDataFormat");
+    }
+
+    // The slot is checked against the instance as it may have been created with an older layout
+    inst_fields_t *fields = (inst_fields_t *)self->data;
+    if (fields == NULL || slot < 0 || slot >= fields->field_count) {
+        return new_error(prog_handler, "ErrVariableNotDefined");
+    }
+    *dest = &(fields->fields[slot]);
+    return NULL;
 }
 
 inst_error_t *get_data(prog_hand_t *prog_handler, var_t *self, void **dest) {
@@ -150,13 +409,13 @@ inst_error_t *get_data(prog_hand_t *prog_handler, var_t *self, void **dest) {
         return new_error(prog_handler, "ErrInvalidParameters");
     }
 
-    // Produce error if variable's data is not managed with a Variable Handler
-    if (!self->desc->type->has_managed_data) {
+    // Produce error if variable's data is managed with a Variable Handler
+    if (var_type(prog_handler, self)->has_managed_data) {
         return new_error(prog_handler, "ErrInvalidDataFormat");
     }
 
-    // Point to new data
-    *dest = self->data;
+    // Point to the data whether it is stored within the variable or in memory of its own
+    *dest = self->inline_data ? (void *)&(self->data) : self->data;
 
     return NULL;
 }
@@ -167,7 +426,7 @@ inst_error_t *get_type(prog_hand_t *prog_handler, var_t *self, class_t **dest) {
         return new_error(prog_handler, "ErrInvalidParameters");
     }
 
-    *dest = self->desc->type;
+    *dest = var_type(prog_handler, self);
     return NULL;
 }
 
@@ -177,7 +436,12 @@ inst_error_t *get_var_name(prog_hand_t *prog_handler, var_t *self, char **dest)
         return new_error(prog_handler, "ErrInvalidParameters");
     }
 
-    *dest = (char *)malloc(strlen(self->desc->name)*sizeof(char));
+    // Immediates have no description so they have no name
+    if (self->desc == NULL) {
+        return new_error(prog_handler, "ErrVariableNotDefined");
+    }
+
+    *dest = (char *)malloc((strlen(self->desc->name) + 1)*sizeof(char));
     if (*dest == NULL) {
         return new_error(prog_handler, "ErrOutOfMemory");
     }
@@ -209,34 +473,13 @@ static inst_error_t *__get_function(prog_hand_t *prog_handler, function_t **dest
         char *funct_name, class_t **param_types, int param_count) {
     inst_error_t *error;
 
-    // Loop through parent classes until a suitable function is found
-    while (self != NULL) {
-        // Attempt to get function
-        add_err(prog_handler, "ErrFunctionNotDefined");
-        error = fhand_get_function(prog_handler, self->inst_methods, dest, funct_name, param_types,
-                                    param_count);
-
-        if (!err_is_equal(error, "ErrFunctionNotDefined")) { // Function was found
-            remove_err(prog_handler, "ErrFunctionNotDefined");
-            return error;
-        }
-
-        get_parent(prog_handler, self, &self);
-        // Function can not be run if a parent does not have managed data
-        if (!self->has_managed_data) {
-            break;
-        }
+    // A function can not exist if its name has never been interned
+    bool sel_exists;
+    int selector;
+    error = selector_exists(prog_handler, &sel_exists, &selector, funct_name);
+    if (error != NULL) return error;
+    if (!sel_exists) {
+        return new_error(prog_handler, "ErrFunctionNotDefined");
     }
-    // Attempt to get function from object class
-    if (self != NULL) {
-        // Get class
-        cls_object_t *class;
-        error = get_class(prog_handler, &class, OBJECT_CLS_NAME);
-        if (error != NULL) return error;
-        // Get function and return any errors
-        return fhand_get_function(prog_handler, self->inst_methods, dest, funct_name, param_types,
-                                    param_count);
-    }
-    // Return ErrFunctionNotDefined
-    return new_error(prog_handler, "ErrFunctionNotDefined");
-}
\ No newline at end of file
+    return get_function_sel(prog_handler, self, dest, selector, param_types, param_count);
+}
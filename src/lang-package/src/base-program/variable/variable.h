@@ -14,25 +14,148 @@ The structures used to represent the Variable
 
 #include "../../typedefs.h"
 
+/* The largest size of unmanaged data that is stored within the variable instead of being allocated */
+#define MAX_INLINE_DATA sizeof(void *)
+
 /*
-Frees the memory occupuied by a Variable structure
+Frees the memory occupied by a Variable structure including the member fields of instances with
+managed data without checking for other references to it. Variables created by new_pooled_var are
+returned to the Variable Pool. Variables stored within another structure, such as the instances of
+an array, only have their data freed as their memory is freed with the structure holding them
 
 *src: The Variable structure whose memory is to be freed
 */
 void free_var(var_t *src);
 
 /*
-Creates a new variable by resetting it to the default values
+Adds a reference to a Variable so that it is not freed until the reference is released with
+release_var. The count is not changed atomically so the variable must only be used by a single
+thread. Embedded variables, such as member fields, the instances of an array and thrown errors, are
+not counted as they last as long as the structure holding them
+
+*src: The Variable to reference
+*/
+void retain_var(var_t *src);
+
+/*
+Releases a reference to a Variable, freeing it with free_var once no references remain. Variables
+are created with a single reference. The count is not changed atomically and embedded variables are
+never freed by a release
+
+*src: The Variable to release, set to NULL to do nothing
+*/
+void release_var(var_t *src);
+
+/*
+Adds a reference to a Variable that may be shared between threads by changing the count atomically.
+Embedded variables are not counted
+
+*src: The Variable to reference
+*/
+void retain_var_atomic(var_t *src);
+
+/*
+Releases a reference to a Variable that may be shared between threads, freeing it with free_var once
+no references remain. Embedded variables are never freed by a release. The counts of the variable
+and of the description it shares with other instances are changed atomically, but the Variable Pool
+is not, so a release that may free the variable must not happen while another thread is creating
+or freeing variables
+
+*src: The Variable to release, set to NULL to do nothing
+*/
+void release_var_atomic(var_t *src);
+
+/*
+Frees the data of a Variable, including the member fields of instances with managed data, without
+freeing its description
+
+*src: The Variable whose data is to be freed
+*/
+void free_var_data(var_t *src);
+
+/*
+Frees a block of member fields including the data of each member field, releasing the descriptions
+they share with the field layout of their class
+
+*src: The block of member fields to be freed, set to NULL to do nothing
+*/
+void free_inst_fields(inst_fields_t *src);
+
+/*
+Frees every instance of an array created by new_var_array and the memory occupied by the array
+
+*src: The array to be freed, set to NULL to do nothing
+*/
+void free_var_array(var_array_t *src);
+
+/*
+Creates a new variable by resetting it to the default values. The description of the variable is
+allocated from the Variable Pool so the variable must be freed before the program handler
 
 *dest: The variable that is to be reset
 
 Errors:
     ErrInvalidParameters: Thrown if 'dest' is set to NULL
+    ErrOutOfMemory: Thrown if there is not enough memory to create the description
 */
 inst_error_t *new_var(prog_hand_t *prog_handler, var_t *dest);
 
 /*
-Sets the values used to describe a variable that is required during initialisation
+Creates a new variable in memory from the Variable Pool rather than malloc and resets it to the
+default values. The variable is returned to the pool when it is freed with free_var
+
+*prog_handler: The program handler that contains the Variable Pool
+**dest: A pointer to where the created variable will be stored
+
+Errors:
+    ErrInvalidParameters: Thrown if 'dest' is set to NULL
+    ErrOutOfMemory: Thrown if there is not enough memory to create the variable
+*/
+inst_error_t *new_pooled_var(prog_hand_t *prog_handler, var_t **dest);
+
+/*
+Creates an immediate, a variable of a primitive class that has no description and stores its data
+within itself so that creating, running functions on and freeing it does not allocate memory. Any
+previous contents of the variable are not freed
+
+*prog_handler: The program handler that contains the classes of immediates
+*dest: The variable that will become the immediate
+tag: The tag of the class of the immediate, such as IMM_INTEGER
+*data: The data that is copied into the immediate, set to NULL to leave the data as zeroes
+
+Errors:
+    ErrInvalidParameters: Thrown if 'dest' is set to NULL or 'tag' is not the tag of an immediate
+    ErrClassNotDefined: Thrown if no class has been given the tag
+*/
+inst_error_t *new_immediate(prog_hand_t *prog_handler, var_t *dest, int tag, void *data);
+
+/*
+Gets the class of a variable, including immediates whose class is found from their tag
+
+*prog_handler: The program handler that contains the classes of immediates
+*var: The variable to get the class of
+
+Returns: The class of the variable
+*/
+class_t *var_type(prog_hand_t *prog_handler, var_t *var);
+
+/*
+Gets an instance from an array created by new_var_array. The instance is stored within the array so
+free_var only frees its data and the instance itself is freed by free_var_array
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The array to get an instance from
+**dest: The location to store the retrieved instance to
+index: The index of the instance within the array
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self' or 'dest' is set to NULL or 'index' is out of range
+*/
+inst_error_t *get_array_var(prog_hand_t *prog_handler, var_array_t *self, var_t **dest, int index);
+
+/*
+Sets the values used to describe a variable that is required during initialisation. Member fields
+share their description with their class so they are given a description of their own instead
 
 *prog_handler: The program handler that contains the class and error handlers
 *dest: A pointer to the variable
@@ -43,11 +166,13 @@ Errors:
     ErrInvalidParameters: Thrown if 'dest', 'type', or 'name' is NULL
     ErrOutOfMemory: Thrown if there is not enough space to copy the name
     ErrClassNotDefined: Thrown if the given class type does not exist in the class handler
+    ErrInvalidDataFormat: Thrown if the variable is an immediate which has no description
 */
 inst_error_t *set_var_desc(prog_hand_t *prog_handler, var_t *dest, char *type, char *name);
 
 /*
-Initialises a new instance of a variable, copying the data exactly
+Initialises a new instance of a variable, copying the data exactly. Data no larger than a pointer is
+stored within the variable itself so that no memory is allocated for it
 
 *prog_handler: The program handler that contains the class and error handlers
 *dest: The location to store the new variable
@@ -80,6 +205,28 @@ Errors: Throws any errors related to the function that is run
 inst_error_t *run_function(prog_hand_t *prog_handler, var_t *self, char *funct_name, 
         var_t *return_var, var_t **params, int param_count);
 
+/*
+Runs a function that is a part of a variable based upon the selector of the function name and the
+parameters. This avoids hashing and comparing the function name on each call
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The variable to run the function for
+selector: The selector of the name of the function to run, as returned by get_selector
+*return_var: The variable to store the return value after running the function
+**params: The list of parameters with which to run the function
+param_count: The number of parameters in the params list
+
+Returns: Returns a variable that is dependent on the function
+
+Errors: Throws any errors related to the function that is run
+    ErrInvalidParameters: Thrown if 'self' is set to NULL
+    ErrFunctionNotDefined: Thrown if a function using the given parameters does not exist
+    ErrOutOfMemory: Thrown if there is not enough memory to construct a class list for the
+                    parameters
+*/
+inst_error_t *run_function_sel(prog_hand_t *prog_handler, var_t *self, int selector,
+        var_t *return_var, var_t **params, int param_count);
+
 /*
 Runs a function that is a part of a variable based upon the function name and parameters and which
 class to initiate the function from
@@ -106,7 +253,7 @@ inst_error_t *run_super_function(prog_hand_t *prog_handler, var_t *self, char *f
         var_t *return_var, var_t **params, int param_count, int super_amount);
 
 /*
-Gets a member field from a variable that inherits from Object classes which use a Variable Handler
+Gets a member field from a variable that inherits from Object classes which use managed data
 
 *prog_handler: The program handler that contains the class and error handlers
 *self: The variable to get a member field from
@@ -116,17 +263,35 @@ Gets a member field from a variable that inherits from Object classes which use
 Errors:
     ErrInvalidParameters: Thrown if 'self', 'dest' or 'field_name' is set to NULL
     ErrVariableNotDefined: Thrown when the given field does not exist
-    ErrInvalidDataFormat: Thrown when the class does not handle its data using a Variable Handler
+    ErrInvalidDataFormat: Thrown when the class does not use managed data
 */
 inst_error_t *get_member_field(prog_hand_t *prog_handler, var_t *self, var_t **dest, 
         char *field_name);
 
 /*
-Gets the data from a variable that does not handle its data using a variable handler
+Gets a member field from a variable using the slot of the member field, as returned by
+get_field_slot, instead of its name. This avoids comparing the name of each member field
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The variable to get a member field from
+**dest: The location to store the retrieved member field to
+slot: The slot of the member field in the field layout of the class
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self' or 'dest' is set to NULL
+    ErrVariableNotDefined: Thrown when the instance does not have a member field in the slot
+    ErrInvalidDataFormat: Thrown when the class does not use managed data
+*/
+inst_error_t *get_member_field_slot(prog_hand_t *prog_handler, var_t *self, var_t **dest,
+        int slot);
+
+/*
+Gets the data from a variable that does not handle its data using a variable handler. The pointer
+refers to the data wherever it is stored, including data stored within the variable itself
 
 *prog_handler: The program handler that contains the class and error handlers
 *self: The variable used to retrieve the data from
-**dest: A pointer to the data that is retrieved
+**dest: A pointer to where the pointer to the data will be stored
 
 Errors:
     ErrInvalidParameters: Thrown if 'self' or 'dest' is set to NULL
@@ -156,6 +321,7 @@ Copies the name of the variable to the specified destination
 Errors:
     ErrInvalidParameters: Thrown if 'self' or 'dest' is set to NULL
     ErrOutOfMemory: Thrown if there is not enough memory to copy the variable's name
+    ErrVariableNotDefined: Thrown if the variable is an immediate which has no name
 */
 inst_error_t *get_var_name(prog_hand_t *prog_handler, var_t *self, char **dest);
 
@@ -14,53 +14,90 @@ The code used to provide for the implementation of a Class Handler
 #include "../../base-program/class/class.h"
 #include "../error-handler/error_handler.h"
 #include "../program-handler/program_handler.h"
+#include "../name-hash/name_hash.h"
+#include "../metadata-arena/meta_arena.h"
+
+/* The number of buckets initially allocated for the Class Handler */
+#define INITIAL_BUCKET_COUNT 16
+
+static class_node_t *__find_node(cls_hand_t *self, char *class_name, unsigned long hash);
+static bool __resize_buckets(cls_hand_t *self, int bucket_count);
+static bool __is_handled(cls_hand_t *self, class_t *class);
 
 void free_cls_hand(cls_hand_t *src) {
     if (src == NULL) return;
 
-    // Free class nodes
-    class_node_t *next, *curr = src->first;
-    while (curr != NULL) {
-        next = curr->next;
-        free_class(curr->class);
-        free(next);
-        curr = next;
+    // Free classes, whose nodes are held in the Metadata Arena
+    for (int i = 0; i < src->class_count; i++) {
+        free_class(src->classes[i]);
     }
+    free(src->buckets);
+    free(src->classes);
     free(src);
 }
 
 void init_cls_hand(cls_hand_t *src) {
-    src->first = NULL;
+    src->buckets = NULL;
+    src->bucket_count = 0;
+    src->classes = NULL;
+    src->class_count = 0;
+    src->class_capacity = 0;
+    src->is_numbered = false;
 }
 
 inst_error_t *add_class(prog_hand_t *prog_handler, class_t *class) {
-    inst_error_t *error;
     if (class == NULL) {
         return new_error(prog_handler, "ErrInvalidParameters");
     }
+    cls_hand_t *cls_handler = prog_handler->cls_handler;
 
-    class_node_t *curr, *prev = NULL;
-    curr = prog_handler->cls_handler->first;
-    // Loop through classes until the node if found
-    while (curr != NULL) {
-        if (!strcmp(class->class_name, curr->class->class_name)) {
-            return new_error(prog_handler, "ErrClassAlreadyExists");
+    // Allocate buckets on first use
+    if (cls_handler->buckets == NULL) {
+        if (!__resize_buckets(cls_handler, INITIAL_BUCKET_COUNT)) {
+            return new_error(prog_handler, "ErrOutOfMemory");
         }
-        prev = curr;
-        curr = curr->next;
     }
-    // Create node at end of list
-    class_node_t *new_node = (class_node_t *)malloc(sizeof(class_node_t));
+
+    // Return an error if the class name is already taken
+    class->name_hash = hash_name(class->class_name);
+    if (__find_node(cls_handler, class->class_name, class->name_hash) != NULL) {
+        return new_error(prog_handler, "ErrClassAlreadyExists");
+    }
+
+    // Grow class list if required
+    if (cls_handler->class_count == cls_handler->class_capacity) {
+        int new_capacity = cls_handler->class_capacity * 2 + INITIAL_BUCKET_COUNT;
+        class_t **classes = (class_t **)realloc(cls_handler->classes,
+                                                new_capacity*sizeof(class_t *));
+        if (classes == NULL) {
+            return new_error(prog_handler, "ErrOutOfMemory");
+        }
+        cls_handler->classes = classes;
+        cls_handler->class_capacity = new_capacity;
+    }
+
+    // Create node at start of bucket
+    class_node_t *new_node = (class_node_t *)arena_alloc(prog_handler, sizeof(class_node_t));
     if (new_node == NULL) {
         return new_error(prog_handler, "ErrOutOfMemory");
     }
-    if (prev != NULL) {
-        prev->next = new_node;
-    } else {
-        prog_handler->cls_handler->first = new_node;
-    }
+    int index = class->name_hash & (cls_handler->bucket_count - 1);
     new_node->class = class;
-    new_node->next = NULL;
+    new_node->next = cls_handler->buckets[index];
+    cls_handler->buckets[index] = new_node;
+
+    // Assign class ID
+    class->class_id = cls_handler->class_count;
+    cls_handler->classes[cls_handler->class_count++] = class;
+    // The class tree has changed so classes must be numbered again
+    class->pre_order = -1;
+    class->subtree_end = -1;
+    cls_handler->is_numbered = false;
+
+    // Keep an average of at most one class per bucket. If this fails, lookups are still correct
+    if (cls_handler->class_count > cls_handler->bucket_count) {
+        __resize_buckets(cls_handler, cls_handler->bucket_count * 2);
+    }
     return NULL;
 }
 
@@ -83,29 +120,162 @@ inst_error_t *get_class(prog_hand_t *prog_handler, class_t **dest, char *class_n
     return NULL;
 }
 
+inst_error_t *get_class_by_id(prog_hand_t *prog_handler, class_t **dest, int class_id) {
+    if (dest == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    // Return error if class ID has not been assigned
+    if (class_id < 0 || class_id >= prog_handler->cls_handler->class_count) {
+        return new_error(prog_handler, "ErrClassNotDefined");
+    }
+
+    *dest = prog_handler->cls_handler->classes[class_id];
+    return NULL;
+}
+
+inst_error_t *number_classes(prog_hand_t *prog_handler) {
+    cls_hand_t *cls_handler = prog_handler->cls_handler;
+    int class_count = cls_handler->class_count;
+    if (cls_handler->is_numbered) return NULL;
+
+    // Build the child lists of each class using class IDs. The stack holds the classes still to be
+    // visited and can never hold more than every class
+    int *first_child = (int *)malloc(class_count*sizeof(int));
+    int *next_sibling = (int *)malloc(class_count*sizeof(int));
+    int *stack = (int *)malloc(class_count*sizeof(int));
+    if ((first_child == NULL || next_sibling == NULL || stack == NULL) && class_count > 0) {
+        free(first_child);
+        free(next_sibling);
+        free(stack);
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+    for (int i = 0; i < class_count; i++) {
+        first_child[i] = -1;
+    }
+    // Add children in reverse so that each child list is in class ID order
+    for (int i = class_count - 1; i >= 0; i--) {
+        class_t *parent = cls_handler->classes[i]->parent;
+        next_sibling[i] = -1;
+        if (__is_handled(cls_handler, parent)) {
+            next_sibling[i] = first_child[parent->class_id];
+            first_child[parent->class_id] = i;
+        }
+    }
+
+    // Walk the tree from each root, assigning the position of a class when it is first visited and
+    // the end of its subtree once every child has been visited
+    int position = 0;
+    for (int root = 0; root < class_count; root++) {
+        if (__is_handled(cls_handler, cls_handler->classes[root]->parent)) continue;
+
+        int stack_size = 0;
+        stack[stack_size++] = root;
+        cls_handler->classes[root]->pre_order = position++;
+        while (stack_size > 0) {
+            int curr = stack[stack_size - 1];
+            int child = first_child[curr];
+            if (child == -1) {
+                cls_handler->classes[curr]->subtree_end = position;
+                stack_size--;
+                continue;
+            }
+            // Remove child from the list so that it is only visited once
+            first_child[curr] = next_sibling[child];
+            cls_handler->classes[child]->pre_order = position++;
+            stack[stack_size++] = child;
+        }
+    }
+
+    free(first_child);
+    free(next_sibling);
+    free(stack);
+    cls_handler->is_numbered = true;
+    return NULL;
+}
+
 inst_error_t *class_exists(prog_hand_t *prog_handler, bool *result, class_t **dest,
         char *class_name) {
-    inst_error_t *error;
     if (result == NULL || class_name == NULL) {
         return new_error(prog_handler, "ErrInvalidParameters");
     }
 
     // Attempt to find class
-    class_node_t *curr = prog_handler->cls_handler->first;
+    class_node_t *node = __find_node(prog_handler->cls_handler, class_name,
+                                        hash_name(class_name));
+    // Set result
+    *result = node != NULL;
+    if (dest != NULL) {
+        *dest = node != NULL ? node->class : NULL;
+    }
+
+    return NULL;
+}
+
+/*
+Finds the node containing the class with the given name
+
+*self: The Class Handler to search
+*class_name: The name of the class to find
+hash: The hash of the class name
+
+Returns: The node containing the class or NULL if the class does not exist
+*/
+static class_node_t *__find_node(cls_hand_t *self, char *class_name, unsigned long hash) {
+    if (self->buckets == NULL) return NULL;
+
+    class_node_t *curr = self->buckets[hash & (self->bucket_count - 1)];
     while (curr != NULL) {
-        int comparison = strcmp(class_name, curr->class->class_name);
-        if (!comparison) {
-            break;
+        // Only compare names when the hashes match
+        if (curr->class->name_hash == hash && !strcmp(class_name, curr->class->class_name)) {
+            return curr;
         }
         curr = curr->next;
     }
-    // Set result
-    *result = curr != NULL;
-    if (curr != NULL && dest != NULL) {
-        *dest = curr->class;
-    } else if (dest != NULL) {
-        *dest = NULL;
+    return NULL;
+}
+
+/*
+Resizes the hash table in the Class Handler, moving all existing nodes into the new buckets
+
+*self: The Class Handler to resize
+bucket_count: The new number of buckets - Must be a power of two
+
+Returns: Whether the buckets could be allocated. The existing buckets are kept on failure
+*/
+static bool __resize_buckets(cls_hand_t *self, int bucket_count) {
+    class_node_t **buckets = (class_node_t **)calloc(bucket_count, sizeof(class_node_t *));
+    if (buckets == NULL) return false;
+
+    // Move nodes into new buckets
+    class_node_t *next, *curr;
+    for (int i = 0; i < self->bucket_count; i++) {
+        curr = self->buckets[i];
+        while (curr != NULL) {
+            next = curr->next;
+            int index = curr->class->name_hash & (bucket_count - 1);
+            curr->next = buckets[index];
+            buckets[index] = curr;
+            curr = next;
+        }
     }
+    free(self->buckets);
+    self->buckets = buckets;
+    self->bucket_count = bucket_count;
+    return true;
+}
 
-    return NULL;
+/*
+Checks whether a class is stored in the Class Handler
+
+*self: The Class Handler to check
+*class: The class to check - May be NULL
+
+Returns: Whether the class is stored in the Class Handler
+*/
+static bool __is_handled(cls_hand_t *self, class_t *class) {
+    if (class == NULL) return false;
+
+    return class->class_id >= 0 && class->class_id < self->class_count &&
+           self->classes[class->class_id] == class;
 }
\ No newline at end of file
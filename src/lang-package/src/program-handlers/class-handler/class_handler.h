@@ -29,7 +29,8 @@ Initialises the Class Handler structure by resetting its values
 void init_cls_hand(cls_hand_t *src);
 
 /*
-Adds a class to the Class Handler assuming that the given class does not already exist
+Adds a class to the Class Handler assuming that the given class does not already exist. The class is
+assigned a class ID which will not change for the lifetime of the Class Handler
 
 *prog_handler: The program handler that contains the class and error handlers
 *class: The class to add to the Class Handler
@@ -54,6 +55,31 @@ Errors:
 */
 inst_error_t *get_class(prog_hand_t *prog_handler, class_t **dest, char *class_name);
 
+/*
+Gets a class from the Class Handler based upon the class ID assigned when it was added
+
+*prog_handler: The program handler that contains the class and error handlers
+**dest: The location to store the retrieved class pointer to
+class_id: The ID of the class to retrieve from the Class Handler
+
+Errors:
+    ErrInvalidParameters: Thrown if 'dest' is set to NULL
+    ErrClassNotDefined: Thrown if no class has been assigned the given class ID
+*/
+inst_error_t *get_class_by_id(prog_hand_t *prog_handler, class_t **dest, int class_id);
+
+/*
+Numbers every class in the Class Handler by its position in the class tree so that subclasses can
+be checked in constant time. This is done automatically when classes are linked or checked after a
+class has been added
+
+*prog_handler: The program handler that contains the class and error handlers
+
+Errors:
+    ErrOutOfMemory: Thrown if there is not enough memory to walk the class tree
+*/
+inst_error_t *number_classes(prog_hand_t *prog_handler);
+
 /*
 Checks whether a class exists and if it does, stores it in the 'dest' variable if it is specified
 
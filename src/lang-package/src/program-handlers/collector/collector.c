@@ -0,0 +1,295 @@
+/*
+Collector
+By Ciaran Gruber
+
+The Collector is an optional tracing collector that may be used instead of freeing variables by
+hand. Variables created with gc_new_var are tracked by the collector and are freed once they can no
+longer be reached from the class variables of every class, the registered roots or the shadow stack.
+Member fields are stored within their instance, so a variable can only refer to another tracked
+variable through unmanaged data, and only the trace hooks of classes with unmanaged data create
+edges between tracked variables. The member fields of a reached instance are visited so that their
+own trace hooks run. Unreachable variables are swept in batches as new variables are created so
+that the cost of each collection is spread out
+
+File-specific:
+Collector - Code File
+The code used to provide for the implementation of a Collector
+*/
+
+#include <string.h>
+#include "collector.h"
+#include "../error-handler/error_handler.h"
+#include "../program-handler/program_handler.h"
+#include "../region/region.h"
+#include "../../base-program/variable/variable.h"
+
+static bool __list_add(gc_list_t *list, var_t *var);
+static void __free_list(gc_list_t *list);
+static inst_error_t *__mark(prog_hand_t *prog_handler);
+static void __clear_marks(collector_t *collector);
+static void __sweep(collector_t *collector, int batch);
+
+void free_collector(collector_t *src) {
+    if (src == NULL) return;
+
+    // Tracked variables may refer to each other but do not own each other so each is freed once
+    for (int i = 0; i < src->tracked.count; i++) {
+        free_var(src->tracked.vars[i]);
+    }
+    __free_list(&(src->tracked));
+    __free_list(&(src->roots));
+    __free_list(&(src->stack));
+    __free_list(&(src->work));
+    __free_list(&(src->visited));
+    free(src);
+}
+
+void init_collector(collector_t *src) {
+    gc_list_t empty = { NULL, 0, 0 };
+    src->tracked = empty;
+    src->roots = empty;
+    src->stack = empty;
+    src->work = empty;
+    src->visited = empty;
+    src->sweep_pos = 0;
+    src->sweep_keep = 0;
+    src->sweep_end = 0;
+    src->threshold = GC_MIN_THRESHOLD;
+}
+
+inst_error_t *gc_new_var(prog_hand_t *prog_handler, var_t **dest) {
+    inst_error_t *error;
+    collector_t *collector = prog_handler->collector;
+    if (dest == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    // Continue the sweep in progress, otherwise begin a collection once enough variables exist
+    if (collector->sweep_end > 0) {
+        __sweep(collector, GC_SWEEP_BATCH);
+    } else if (collector->tracked.count >= collector->threshold) {
+        error = __mark(prog_handler);
+        if (error != NULL) return error;
+        collector->sweep_end = collector->tracked.count;
+        __sweep(collector, GC_SWEEP_BATCH);
+    }
+
+    // Tracked variables outlast any region so they are always allocated from the pool
+    var_t *var;
+    region_mark_t *top = region_pause(prog_handler);
+    error = new_pooled_var(prog_handler, &var);
+    region_resume(prog_handler, top);
+    if (error != NULL) return error;
+    if (!__list_add(&(collector->tracked), var)) {
+        free_var(var);
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+    var->gc_flags = GC_TRACKED;
+    *dest = var;
+    return NULL;
+}
+
+inst_error_t *gc_add_root(prog_hand_t *prog_handler, var_t *root) {
+    if (root == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+    if (!__list_add(&(prog_handler->collector->roots), root)) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+    return NULL;
+}
+
+inst_error_t *gc_remove_root(prog_hand_t *prog_handler, var_t *root) {
+    gc_list_t *roots = &(prog_handler->collector->roots);
+    for (int i = 0; i < roots->count; i++) {
+        if (roots->vars[i] == root) {
+            // The order of the roots does not matter so the last root fills the gap
+            roots->vars[i] = roots->vars[roots->count - 1];
+            roots->count--;
+            return NULL;
+        }
+    }
+    return new_error(prog_handler, "ErrVariableNotDefined");
+}
+
+inst_error_t *gc_push(prog_hand_t *prog_handler, var_t *var) {
+    if (var == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+    if (!__list_add(&(prog_handler->collector->stack), var)) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+    return NULL;
+}
+
+inst_error_t *gc_pop(prog_hand_t *prog_handler, int count) {
+    gc_list_t *stack = &(prog_handler->collector->stack);
+    if (count < 0 || count > stack->count) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+    stack->count -= count;
+    return NULL;
+}
+
+inst_error_t *gc_mark(prog_hand_t *prog_handler, var_t *var) {
+    collector_t *collector = prog_handler->collector;
+    if (var == NULL || (var->gc_flags & GC_MARKED)) return NULL;
+
+    // Untracked variables are recorded so that their marks can be cleared after the collection
+    if (!(var->gc_flags & GC_TRACKED) && !__list_add(&(collector->visited), var)) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+    var->gc_flags |= GC_MARKED;
+    if (!__list_add(&(collector->work), var)) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+    return NULL;
+}
+
+inst_error_t *gc_collect(prog_hand_t *prog_handler) {
+    inst_error_t *error;
+    collector_t *collector = prog_handler->collector;
+
+    // A new collection can not begin until the marks of the last one have been swept
+    if (collector->sweep_end > 0) {
+        __sweep(collector, collector->sweep_end);
+    }
+    error = __mark(prog_handler);
+    if (error != NULL) return error;
+    collector->sweep_end = collector->tracked.count;
+    __sweep(collector, collector->sweep_end);
+    return NULL;
+}
+
+/*
+Adds a variable to the end of a list, doubling its capacity if it is full
+
+*list: The list to add to
+*var: The variable to add
+
+Returns: Whether the variable was added, which is only false if there is not enough memory
+*/
+static bool __list_add(gc_list_t *list, var_t *var) {
+    if (list->count == list->capacity) {
+        int capacity = list->capacity > 0 ? list->capacity*2 : 64;
+        var_t **vars = (var_t **)realloc(list->vars, capacity*sizeof(var_t *));
+        if (vars == NULL) return false;
+        list->vars = vars;
+        list->capacity = capacity;
+    }
+    list->vars[list->count++] = var;
+    return true;
+}
+
+/*
+Frees the memory used by a list without freeing the variables within it
+
+*list: The list to free
+*/
+static void __free_list(gc_list_t *list) {
+    free(list->vars);
+    list->vars = NULL;
+    list->count = 0;
+    list->capacity = 0;
+}
+
+/*
+Marks every variable that can be reached from the class variables, the registered roots and the
+shadow stack. The marks of untracked variables are cleared afterwards so only tracked variables
+remain marked for the sweep
+
+*prog_handler: The program handler that contains the Collector
+*/
+static inst_error_t *__mark(prog_hand_t *prog_handler) {
+    inst_error_t *error = NULL;
+    collector_t *collector = prog_handler->collector;
+    cls_hand_t *cls_handler = prog_handler->cls_handler;
+
+    for (int i = 0; i < cls_handler->class_count && error == NULL; i++) {
+        var_hand_t *class_vars = cls_handler->classes[i]->class_vars;
+        if (class_vars == NULL) continue;
+        for (var_hand_node_t *node = class_vars->first; node != NULL && error == NULL;
+                node = node->next) {
+            error = gc_mark(prog_handler, node->variable);
+        }
+    }
+    for (int i = 0; i < collector->roots.count && error == NULL; i++) {
+        error = gc_mark(prog_handler, collector->roots.vars[i]);
+    }
+    for (int i = 0; i < collector->stack.count && error == NULL; i++) {
+        error = gc_mark(prog_handler, collector->stack.vars[i]);
+    }
+
+    // Trace the references of each marked variable until no unvisited variables remain. Member
+    // fields are embedded in their instance so they are visited only to run their trace hooks
+    while (collector->work.count > 0 && error == NULL) {
+        var_t *var = collector->work.vars[--collector->work.count];
+        if (var->desc == NULL || !var->initialised) continue;
+        class_t *class = var->desc->type;
+        if (class->has_managed_data) {
+            inst_fields_t *fields = (inst_fields_t *)var->data;
+            int field_count = fields != NULL ? fields->field_count : 0;
+            for (int i = 0; i < field_count && error == NULL; i++) {
+                error = gc_mark(prog_handler, &(fields->fields[i]));
+            }
+        } else if (class->trace != NULL) {
+            error = class->trace(prog_handler, var);
+        }
+    }
+
+    // Nothing is freed if the trace could not finish as reachable variables may not be marked
+    if (error != NULL) {
+        collector->work.count = 0;
+        for (int i = 0; i < collector->tracked.count; i++) {
+            collector->tracked.vars[i]->gc_flags &= ~GC_MARKED;
+        }
+    }
+    __clear_marks(collector);
+    return error;
+}
+
+/*
+Clears the marks of the untracked variables marked during a collection
+
+*collector: The Collector whose visited variables are to be cleared
+*/
+static void __clear_marks(collector_t *collector) {
+    for (int i = 0; i < collector->visited.count; i++) {
+        collector->visited.vars[i]->gc_flags &= ~GC_MARKED;
+    }
+    collector->visited.count = 0;
+}
+
+/*
+Sweeps a batch of the variables that were tracked when the collection began, freeing those that were
+not marked and clearing the marks of those that were. The sweep finishes once every variable has
+been swept and the next collection begins when twice as many variables are tracked
+
+*collector: The Collector whose variables are to be swept
+batch: The largest number of variables to sweep
+*/
+static void __sweep(collector_t *collector, int batch) {
+    gc_list_t *tracked = &(collector->tracked);
+    while (batch > 0 && collector->sweep_pos < collector->sweep_end) {
+        var_t *var = tracked->vars[collector->sweep_pos++];
+        if (var->gc_flags & GC_MARKED) {
+            var->gc_flags &= ~GC_MARKED;
+            tracked->vars[collector->sweep_keep++] = var;
+        } else {
+            free_var(var);
+        }
+        batch--;
+    }
+    if (collector->sweep_pos < collector->sweep_end) return;
+
+    // Move the variables created during the sweep down to follow those that were kept
+    int created = tracked->count - collector->sweep_end;
+    memmove(&(tracked->vars[collector->sweep_keep]), &(tracked->vars[collector->sweep_end]),
+            created*sizeof(var_t *));
+    tracked->count = collector->sweep_keep + created;
+    collector->sweep_pos = 0;
+    collector->sweep_keep = 0;
+    collector->sweep_end = 0;
+    collector->threshold = tracked->count*2 > GC_MIN_THRESHOLD ? tracked->count*2 :
+                           GC_MIN_THRESHOLD;
+}
\ No newline at end of file
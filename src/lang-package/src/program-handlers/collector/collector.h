@@ -0,0 +1,161 @@
+/*
+Collector
+By Ciaran Gruber
+
+The Collector is an optional tracing collector that may be used instead of freeing variables by
+hand. Variables created with gc_new_var are tracked by the collector and are freed once they can no
+longer be reached from the class variables of every class, the registered roots or the shadow stack.
+Member fields are stored within their instance, so a variable can only refer to another tracked
+variable through unmanaged data, and only the trace hooks of classes with unmanaged data create
+edges between tracked variables. The member fields of a reached instance are visited so that their
+own trace hooks run. Unreachable variables are swept in batches as new variables are created so
+that the cost of each collection is spread out
+
+File-specific:
+Collector - Header File
+The structures used to represent a Collector
+*/
+
+#ifndef COLLECTOR
+#define COLLECTOR
+
+#include "../../typedefs.h"
+
+/* The flag set on variables tracked by the collector */
+#define GC_TRACKED 1
+/* The flag set on variables that have been reached during the current collection */
+#define GC_MARKED 2
+
+/* The number of tracked variables that may be created before the first collection */
+#define GC_MIN_THRESHOLD 256
+/* The number of tracked variables swept each time a tracked variable is created */
+#define GC_SWEEP_BATCH 32
+
+typedef struct gc_list gc_list_t;
+
+/* A list of variables that grows as variables are added */
+struct gc_list {
+    var_t **vars; // The variables in the list
+    int count;    // The number of variables in the list
+    int capacity; // The number of variables that fit in the list before it must grow
+};
+
+/* A structure that holds the tracked variables and the roots they are reached from */
+struct gen_collector {
+    gc_list_t tracked; // Every variable created with gc_new_var that has not been freed
+    gc_list_t roots;   // The registered roots
+    gc_list_t stack;   // The shadow stack of variables in use by running functions
+    gc_list_t work;    // The marked variables whose references have not been traced yet
+    gc_list_t visited; // The untracked variables marked during the current collection
+    /*
+    The position of the sweep within the tracked variables. Variables before 'sweep_end' were
+    tracked when the collection began and those created since are kept until the next collection
+    */
+    int sweep_pos;
+    int sweep_keep;    // The number of variables kept so far by the sweep
+    int sweep_end;     // The number of variables being swept - 0 if no sweep is in progress
+    int threshold;     // The number of tracked variables at which the next collection begins
+};
+
+/*
+Frees the memory occupied by a Collector structure including every variable it tracks
+
+*src: The Collector structure whose memory is to be freed
+*/
+void free_collector(collector_t *src);
+
+/*
+Initialises the Collector structure without tracking any variables
+
+*src: The Collector to initialise
+*/
+void init_collector(collector_t *src);
+
+/*
+Creates a new variable from the Variable Pool that is tracked by the collector and freed once it can
+no longer be reached. The variable must not be freed or released and must not be initialised within
+a region, and Variable Handlers such as the class variables of a class refuse to hold it. Creating a
+variable may begin a collection, so variables in use that are not reachable from a root must be
+pushed onto the shadow stack beforehand
+
+*prog_handler: The program handler that contains the Collector
+**dest: A pointer to where the created variable will be stored
+
+Errors:
+    ErrInvalidParameters: Thrown if 'dest' is set to NULL
+    ErrOutOfMemory: Thrown if there is not enough memory to create or track the variable
+*/
+inst_error_t *gc_new_var(prog_hand_t *prog_handler, var_t **dest);
+
+/*
+Registers a variable as a root so that it and every variable it refers to are not collected
+
+*prog_handler: The program handler that contains the Collector
+*root: The variable to register
+
+Errors:
+    ErrInvalidParameters: Thrown if 'root' is set to NULL
+    ErrOutOfMemory: Thrown if there is not enough memory to register the root
+*/
+inst_error_t *gc_add_root(prog_hand_t *prog_handler, var_t *root);
+
+/*
+Removes a variable registered as a root
+
+*prog_handler: The program handler that contains the Collector
+*root: The variable to remove
+
+Errors:
+    ErrVariableNotDefined: Thrown if the variable is not registered as a root
+*/
+inst_error_t *gc_remove_root(prog_hand_t *prog_handler, var_t *root);
+
+/*
+Pushes a variable onto the shadow stack so that it is not collected while it is in use, such as a
+temporary variable or a parameter of a running function
+
+*prog_handler: The program handler that contains the Collector
+*var: The variable to push
+
+Errors:
+    ErrInvalidParameters: Thrown if 'var' is set to NULL
+    ErrOutOfMemory: Thrown if there is not enough memory to push the variable
+*/
+inst_error_t *gc_push(prog_hand_t *prog_handler, var_t *var);
+
+/*
+Pops variables from the shadow stack once they are no longer in use
+
+*prog_handler: The program handler that contains the Collector
+count: The number of variables to pop
+
+Errors:
+    ErrInvalidParameters: Thrown if 'count' is negative or larger than the shadow stack
+*/
+inst_error_t *gc_pop(prog_hand_t *prog_handler, int count);
+
+/*
+Marks a variable as reachable during a collection. Trace hooks call this for every variable referred
+to by the unmanaged data of an instance
+
+*prog_handler: The program handler that contains the Collector
+*var: The variable that is reachable, set to NULL to do nothing
+
+Errors:
+    ErrOutOfMemory: Thrown if there is not enough memory to trace the variable
+*/
+inst_error_t *gc_mark(prog_hand_t *prog_handler, var_t *var);
+
+/*
+Runs a whole collection at once, finishing any sweep in progress and then freeing every tracked
+variable that can not be reached
+
+*prog_handler: The program handler that contains the Collector
+
+Errors:
+    ErrOutOfMemory: Thrown if there is not enough memory to trace the variables, in which case no
+                    variables are freed by the collection
+*/
+inst_error_t *gc_collect(prog_hand_t *prog_handler);
+
+#endif
\ No newline at end of file
@@ -9,16 +9,23 @@ Error Handler - Code File
 The code used to provide for the implementation of a Error Handler
 */
 
+#include <stdio.h>
 #include <string.h>
 #include "error_handler.h"
 #include "../program-handler/program_handler.h"
 #include "../class-handler/class_handler.h"
+#include "../variable-pool/var_pool.h"
+#include "../metadata-arena/meta_arena.h"
 #include "../../base-program/variable/variable.h"
 #include "../../base-program/class/class.h"
 #include "../../types/Error/t_Error.h"
 
-static void __remove_err_ref(prog_hand_t *prog_handler, err_hand_node_t *prev_node);
-static err_hand_node_t *__find_err_position(err_hand_t *self, cls_error_t *error);
+/* The name given to the preallocated instance of each error class */
+#define ERROR_VAR_NAME "error_var"
+
+static inst_error_t *__reserve_counts(prog_hand_t *prog_handler, int class_id);
+static inst_error_t *__new_error_inst(prog_hand_t *prog_handler, cls_error_t *error_class);
+static bool __is_error_cls(cls_error_t *error_class);
 
 int test() {
     return 1;
@@ -27,82 +34,88 @@ int test() {
 void free_err_hand(err_hand_t *src) {
     if (src == NULL) return;
 
-    err_hand_node_t *next, *curr = src->first;
-    while (curr != NULL) {
-        next = curr->next;
-        free(curr);
-        curr = next;
-    }
+    free(src->catch_counts);
     free(src);
 }
 
 void init_err_hand(err_hand_t *src) {
-    src->first = NULL;
+    src->catch_counts = NULL;
+    src->catch_capacity = 0;
 }
 
 inst_error_t *add_err(prog_hand_t *prog_handler, char *error_name) {
+    inst_error_t *error;
     if (error_name == NULL) {
         return new_error(prog_handler, "ErrInvalidParameters");
     }
 
     // Get error class
     cls_error_t *error_cls;
-    get_class(prog_handler, &error_cls, error_name);
-
-    // Create node
-    err_hand_node_t *curr = prog_handler->err_handler->first;
-    err_hand_node_t *new_node = (err_hand_node_t *)malloc(sizeof(err_hand_node_t));
-    new_node->allowed_error = error_cls;
-    // Add node to start so it is easier to find in a linear search
-    new_node->next = prog_handler->err_handler->first;
-    prog_handler->err_handler->first = new_node;
+    error = get_class(prog_handler, &error_cls, error_name);
+    if (error != NULL) return error;
+
+    return add_err_cls(prog_handler, error_cls);
+}
+
+inst_error_t *add_err_cls(prog_hand_t *prog_handler, cls_error_t *error_class) {
+    inst_error_t *error;
+    if (error_class == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    // Make space for the class ID if it has not been counted before
+    error = __reserve_counts(prog_handler, error_class->class_id);
+    if (error != NULL) return error;
+
+    prog_handler->err_handler->catch_counts[error_class->class_id]++;
+    return NULL;
 }
 
 void handle_err(prog_hand_t *prog_handler, inst_error_t *error_instance) {
     if (error_instance == NULL) {
         return;
     }
-    // Attempt to find the equivalent error
-    err_hand_node_t *prev, *curr;
-    prev = __find_err_position(prog_handler->err_handler, error_instance->desc->type);
-    if (prev == NULL) {
-        curr = prog_handler->err_handler->first;
-    } else {
-        curr = prev->next;
-    }
+    err_hand_t *err_handler = prog_handler->err_handler;
+    int class_id = error_instance->desc->type->class_id;
 
     // Remove error from handler if it was found and return
-    if (curr != NULL && curr->allowed_error != error_instance->desc->type) {
-        __remove_err_ref(prog_handler, prev);
+    if (class_id >= 0 && class_id < err_handler->catch_capacity &&
+            err_handler->catch_counts[class_id] > 0) {
+        err_handler->catch_counts[class_id]--;
         return;
     }
-    // Print error message and exit if found
-    run_function(prog_handler, error_instance, "print_error", NULL, NULL, 0);
+    // Print error message and exit if not found
+    fprintf(stderr, "Uncaught error: %s\n", error_instance->desc->type->class_name);
     exit(EXIT_FAILURE);
 }
 
 inst_error_t *remove_err(prog_hand_t *prog_handler, char *error_name) {
+    inst_error_t *error;
     if (error_name == NULL) {
         return new_error(prog_handler, "ErrInvalidParameters");
     }
 
     // Get error class
     cls_error_t *error_cls;
-    get_class(prog_handler, &error_cls, error_name);
+    error = get_class(prog_handler, &error_cls, error_name);
+    if (error != NULL) return error;
+
+    return remove_err_cls(prog_handler, error_cls);
+}
 
-    // Find error
-    err_hand_node_t *prev, *curr;
-    prev = __find_err_position(prog_handler->err_handler, error_cls);
-    if (prev == NULL) {
-        curr = prog_handler->err_handler->first;
-    } else {
-        curr = prev->next;
+inst_error_t *remove_err_cls(prog_hand_t *prog_handler, cls_error_t *error_class) {
+    if (error_class == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
     }
+    err_hand_t *err_handler = prog_handler->err_handler;
+    int class_id = error_class->class_id;
 
     // Remove error if it is present
-    if (curr != NULL && curr->allowed_error != error_cls) {
-        __remove_err_ref(prog_handler, prev);  
-    }  
+    if (class_id >= 0 && class_id < err_handler->catch_capacity &&
+            err_handler->catch_counts[class_id] > 0) {
+        err_handler->catch_counts[class_id]--;
+    }
+    return NULL;
 }
 
 bool err_is_equal(inst_error_t *actual, char *expected) {
@@ -116,36 +129,143 @@ bool err_is_equal(inst_error_t *actual, char *expected) {
     return strcmp(actual->desc->type->class_name, expected) ? false : true;
 }
 
+bool err_is_class(inst_error_t *actual, cls_error_t *expected) {
+    // Handle NULL cases
+    if (actual == NULL) {
+        return expected == NULL;
+    }
+    // Each class only has a single error instance so the classes can be compared directly
+    return actual->desc->type == expected;
+}
+
 inst_error_t *new_error(prog_hand_t *prog_handler, char *error_type) {
-    inst_error_t *error = (inst_error_t *)malloc(sizeof(inst_error_t));
-    new_var(prog_handler, error);
-    set_var_desc(prog_handler, error, error_type, "error_var");
-    init_var(prog_handler, error, NULL, 0);
-    handle_err(prog_handler, error);
-    return error;
+    cls_error_t *error_class = NULL;
+    bool cls_exists = false;
+
+    // Find the class without using get_class as a missing class would throw another error. Use the
+    // base Error class if the error class does not exist
+    if (error_type != NULL) {
+        class_exists(prog_handler, &cls_exists, &error_class, error_type);
+    }
+    if (!cls_exists) {
+        class_exists(prog_handler, &cls_exists, &error_class, ERROR_CLS_NAME);
+    }
+    // Exit as the error can not be represented without an Error class
+    if (!cls_exists) {
+        fprintf(stderr, "Uncaught error: %s\n", error_type != NULL ? error_type : ERROR_CLS_NAME);
+        exit(EXIT_FAILURE);
+    }
+
+    return throw_error(prog_handler, error_class);
 }
 
-static void __remove_err_ref(prog_hand_t *prog_handler, err_hand_node_t *prev_node) {
-    err_hand_node_t *curr;
-    if (prev_node != NULL) {
-        curr = prev_node->next;
-        prev_node->next = curr->next;
-    } else {
-        curr = prog_handler->err_handler->first;
-        prog_handler->err_handler->first = curr->next;
+inst_error_t *throw_error(prog_hand_t *prog_handler, cls_error_t *error_class) {
+    // Create the error instance if it was not preallocated when the class was created
+    if (error_class->error_inst == NULL && __new_error_inst(prog_handler, error_class) == NULL) {
+        fprintf(stderr, "Uncaught error: ErrOutOfMemory\n");
+        exit(EXIT_FAILURE);
     }
-    free(curr);
+
+    handle_err(prog_handler, error_class->error_inst);
+    return error_class->error_inst;
 }
 
-static err_hand_node_t *__find_err_position(err_hand_t *self, cls_error_t *error) {
-    err_hand_node_t *prev = NULL;
-    err_hand_node_t *curr = self->first;
-    while (curr != NULL) {
-        if (curr->allowed_error == error) {
-            return prev;
-        }
-        prev = curr;
-        curr = curr->next;
-    }
-    return prev;
+inst_error_t *prealloc_error(prog_hand_t *prog_handler, cls_error_t *error_class) {
+    if (error_class == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    // Only Error classes are thrown
+    if (error_class->error_inst != NULL || !__is_error_cls(error_class)) return NULL;
+
+    if (__new_error_inst(prog_handler, error_class) == NULL) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+    return NULL;
+}
+
+/*
+Resizes the catch counts of the Error Handler so that the given class ID can be counted. The counts
+are resized to fit every class that the Class Handler has space for so that resizing is rare
+
+*prog_handler: The program handler that contains the class and error handlers
+class_id: The class ID that is to be counted
+
+Errors:
+    ErrOutOfMemory: Thrown if there is not enough memory to resize the catch counts
+*/
+static inst_error_t *__reserve_counts(prog_hand_t *prog_handler, int class_id) {
+    err_hand_t *err_handler = prog_handler->err_handler;
+    if (class_id < err_handler->catch_capacity) return NULL;
+
+    int new_capacity = prog_handler->cls_handler->class_capacity;
+    if (new_capacity <= class_id) {
+        new_capacity = class_id + 1;
+    }
+    int *new_counts = (int *)realloc(err_handler->catch_counts, new_capacity*sizeof(int));
+    if (new_counts == NULL) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+    // Classes that have not been counted have not been added
+    for (int i = err_handler->catch_capacity; i < new_capacity; i++) {
+        new_counts[i] = 0;
+    }
+    err_handler->catch_counts = new_counts;
+    err_handler->catch_capacity = new_capacity;
+    return NULL;
+}
+
+/*
+Creates the immutable error instance of a class and stores it in the class. The instance has no data
+as it is shared by every error of the class that is thrown
+
+*prog_handler: The program handler that contains the Variable Pool
+*error_class: The class to create the error instance for
+
+Returns: The created error instance or NULL if there was not enough memory to create it
+*/
+static inst_error_t *__new_error_inst(prog_hand_t *prog_handler, cls_error_t *error_class) {
+    // The error instance lasts as long as its class so it is held in the Metadata Arena
+    inst_error_t *error_inst = (inst_error_t *)arena_alloc(prog_handler, sizeof(inst_error_t));
+    var_desc_t *desc = (var_desc_t *)pool_alloc(prog_handler, sizeof(var_desc_t));
+    if (error_inst == NULL || desc == NULL) {
+        pool_free(desc);
+        return NULL;
+    }
+
+    // Set description directly as the class is already known. The description is never changed so
+    // the constant name is used rather than copying it
+    desc->type = error_class;
+    desc->name = ERROR_VAR_NAME;
+    desc->owns_name = false;
+    desc->initialised = true;
+    atomic_init(&(desc->ref_count), 1);
+    error_inst->desc = desc;
+    error_inst->data = NULL;
+    error_inst->initialised = true;
+    error_inst->pooled = false;
+    error_inst->embedded = true;
+    error_inst->inline_data = false;
+    error_inst->gc_flags = 0;
+    error_inst->imm_tag = IMM_NONE;
+    atomic_init(&(error_inst->ref_count), 1);
+
+    error_class->error_inst = error_inst;
+    return error_inst;
+}
+
+/*
+Checks whether a class is the Error class or a subclass of it. The parent classes are followed as
+the class may not have been numbered by the Class Handler yet
+
+*error_class: The class to check
+
+Returns: A boolean value representing whether the class is an Error class
+*/
+static bool __is_error_cls(cls_error_t *error_class) {
+    while (error_class != NULL) {
+        if (strcmp(error_class->class_name, ERROR_CLS_NAME) == 0) return true;
+        error_class = error_class->parent;
+    }
+    return false;
 }
\ No newline at end of file
@@ -29,16 +29,32 @@ Initialises an Error Handler by resetting the structure without freeing memory
 void init_err_hand(err_hand_t *src);
 
 /*
-Adds a class to the Error Handler if the given error does not already exist
+Adds a class to the Error Handler so that the next error of the class is caught. Adding a class
+multiple times catches that many errors of the class
 
 *prog_handler: The program handler that contains the class and error handlers
 *error: The error class to add to the Error Handler
 
 Errors:
     ErrInvalidParameters: Thrown if 'error' is set to NULL
+    ErrClassNotDefined: Thrown if the error class does not exist
+    ErrOutOfMemory: Thrown if there is not enough memory to add the error class
 */
 inst_error_t *add_err(prog_hand_t *prog_handler, char *error_name);
 
+/*
+Adds a class to the Error Handler using the class rather than its name. This takes constant time and
+does not allocate memory once the class has been added before
+
+*prog_handler: The program handler that contains the class and error handlers
+*error_class: The error class to add to the Error Handler
+
+Errors:
+    ErrInvalidParameters: Thrown if 'error_class' is set to NULL
+    ErrOutOfMemory: Thrown if there is not enough memory to add the error class
+*/
+inst_error_t *add_err_cls(prog_hand_t *prog_handler, cls_error_t *error_class);
+
 /*
 Handles any existing errors by exiting the program if the errors have not been cauught as well as
 printing the related error messages
@@ -56,9 +72,21 @@ Deletes an error from the Error Handler based upon the class of error
 
 Errors:
     ErrInvalidParameters: Thrown if 'error' is set to NULL
+    ErrClassNotDefined: Thrown if the error class does not exist
 */
 inst_error_t *remove_err(prog_hand_t *prog_handler, char *error_name);
 
+/*
+Deletes an error from the Error Handler using the class rather than its name
+
+*prog_handler: The program handler that contains the class and error handlers
+*error_class: The error class to delete from the Error Handler
+
+Errors:
+    ErrInvalidParameters: Thrown if 'error_class' is set to NULL
+*/
+inst_error_t *remove_err_cls(prog_hand_t *prog_handler, cls_error_t *error_class);
+
 /*
 Compares an instance of an error to the expected error that was to be produced
 
@@ -70,7 +98,19 @@ Returns: A boolean value representing whether the error and the given name is th
 bool err_is_equal(inst_error_t *actual, char *expected);
 
 /*
-Creates a new instance of an error and returns a pointer to the new error
+Compares an instance of an error to the class of the expected error. This is faster than comparing
+using the name of the error as only the classes are compared
+
+*actual: The error instance that was produced by the function
+*expected: The class of the error that was expected to occur
+
+Returns: A boolean value representing whether the error is an instance of the given class
+*/
+bool err_is_class(inst_error_t *actual, cls_error_t *expected);
+
+/*
+Throws an error of the given type and returns a pointer to the error. If the error type does not
+exist, an error of the base Error class is thrown instead
 
 *prog_handler: The program handler that contains the class and error handlers
 *error_type: The name of the error type
@@ -79,4 +119,30 @@ Returns: The error associated with the given type
 */
 inst_error_t *new_error(prog_hand_t *prog_handler, char *error_type);
 
+/*
+Throws an error of the given class and returns a pointer to the error. Errors are not created when
+they are thrown but are instead the immutable instance preallocated for the class so that throwing
+and catching an error does not allocate memory. The returned error is shared by every error of the
+same class and must not be modified or freed
+
+*prog_handler: The program handler that contains the class and error handlers
+*error_class: The class of the error to throw
+
+Returns: The error associated with the given class
+*/
+inst_error_t *throw_error(prog_hand_t *prog_handler, cls_error_t *error_class);
+
+/*
+Preallocates the error instance of a class so that no memory is allocated when it is thrown. This is
+done when a class is created and classes that are not the Error class or a subclass of it are ignored
+
+*prog_handler: The program handler that contains the class and error handlers
+*error_class: The class to preallocate the error instance for
+
+Errors:
+    ErrInvalidParameters: Thrown if 'error_class' is set to NULL
+    ErrOutOfMemory: Thrown if there is not enough memory to create the error instance
+*/
+inst_error_t *prealloc_error(prog_hand_t *prog_handler, cls_error_t *error_class);
+
 #endif
\ No newline at end of file
@@ -13,6 +13,7 @@ The code used to provide for the implementation of a Function Handler
 #include "function_handler.h"
 #include "../error-handler/error_handler.h"
 #include "../../base-program/function/function_set.h"
+#include "../metadata-arena/meta_arena.h"
 
 static void __get_node(funct_hand_t *self, funct_hand_node_t **node, char *name);
 static void __get_next_node(funct_hand_t *self, funct_hand_node_t *prev, funct_hand_node_t **next,
@@ -23,14 +24,12 @@ static void __get_prev_node(funct_hand_t *self, bool *funct_exists, funct_hand_n
 void free_funct_hand(funct_hand_t *src) {
     if (src == NULL) return;
 
-    funct_hand_node_t *temp, *curr = src->first;
+    // The handler, its nodes and function sets are held in the Metadata Arena
+    funct_hand_node_t *curr = src->first;
     while (curr != NULL) {
         free_funct_set(curr->function_set);
-        temp = curr;
         curr = curr->next;
-        free(temp);
     }
-    free(src);
 }
 
 inst_error_t *new_fhand(prog_hand_t *prog_handler, funct_hand_t *dest) {
@@ -38,6 +37,7 @@ inst_error_t *new_fhand(prog_hand_t *prog_handler, funct_hand_t *dest) {
         return new_error(prog_handler, "ErrInvalidParameters");
     }
     dest->first = NULL;
+    return NULL;
 }
 
 inst_error_t *fhand_add_function(prog_hand_t *prog_handler, funct_hand_t *self, function_t *function) {
@@ -58,7 +58,15 @@ inst_error_t *fhand_add_function(prog_hand_t *prog_handler, funct_hand_t *self,
     }
 
     // Function set doesn't exist exist
-    funct_hand_node_t *new_node = (funct_hand_node_t *)malloc(sizeof(funct_hand_node_t));
+    funct_hand_node_t *new_node = (funct_hand_node_t *)arena_alloc(prog_handler,
+                                                                   sizeof(funct_hand_node_t));
+    if (new_node == NULL) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+    new_node->function_set = (function_set_t *)arena_alloc(prog_handler, sizeof(function_set_t));
+    if (new_node->function_set == NULL) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
     // Create function set
     error = new_funct_set(prog_handler, new_node->function_set, function->name);
     if (error != NULL) return error;
@@ -106,7 +114,6 @@ inst_error_t *fhand_remove_function(prog_hand_t *prog_handler, funct_hand_t *sel
         } else {
             prev->next = curr->next;
         }
-        free(curr);
     }
     return NULL;
 }
@@ -118,15 +125,34 @@ inst_error_t *fhand_get_function(prog_hand_t *prog_handler, funct_hand_t *self,
         return new_error(prog_handler, "ErrInvalidParameters");
     }
 
+    // Attempt to get function
+    bool found;
+    error = fhand_try_get_function(prog_handler, self, &found, dest, name, param_types,
+                                   param_count);
+    if (error != NULL) return error;
+    if (!found) {
+        return new_error(prog_handler, "ErrFunctionNotDefined");
+    }
+    return NULL;
+}
+
+inst_error_t *fhand_try_get_function(prog_hand_t *prog_handler, funct_hand_t *self, bool *found,
+        function_t **dest, char *name, class_t **param_types, int param_count) {
+    inst_error_t *error;
+    if (self == NULL || found == NULL || dest == NULL || name == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
     // Get the function node
     funct_hand_node_t *curr;
     __get_node(self, &curr, name);
-    // Throw error if node could not be found
     if (curr == NULL) {
-        return new_error(prog_handler, "ErrFunctionNotDefined");
+        *found = false;
+        return NULL;
     }
     // Get function from function set
-    error = fset_get_function(prog_handler, curr->function_set, dest, param_types, param_count);
+    error = fset_try_get_function(prog_handler, curr->function_set, found, dest, param_types,
+                                  param_count);
     return error;
 }
 
@@ -145,8 +171,9 @@ inst_error_t *fhand_function_exists(prog_hand_t *prog_handler, bool *result, fun
         return NULL;
     }
     // Check function set
-    *result = fset_function_exists(prog_handler, curr->function_set, result, param_types, param_count);
-    return NULL;
+    error = fset_function_exists(prog_handler, curr->function_set, result, param_types,
+                                param_count);
+    return error;
 }
 
 static void __get_prev_node(funct_hand_t *self, bool *fset_exists, funct_hand_node_t **prev_node,
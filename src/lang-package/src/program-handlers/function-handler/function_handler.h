@@ -15,7 +15,8 @@ The structures used to represent a Function Handler
 #include "../../typedefs.h"
 
 /*
-Frees the memory occupuied by a Function Handler structure
+Frees the Functions within a Function Handler structure. The handler, its nodes and its
+function sets are held in the Metadata Arena and are freed along with the program handler
 
 *src: The Function Handler structure whose memory is to be freed
 */
@@ -78,6 +79,24 @@ Errors:
 inst_error_t *fhand_get_function(prog_hand_t *prog_handler, funct_hand_t *self, function_t **dest,
         char *name, class_t **param_types, int param_count);
 
+/*
+Gets a function from the handler based upon the name and parameters without throwing an error if the
+function could not be found
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The Function Handler to get the function from
+*found: A boolean value representing whether the function was found
+**dest: A pointer to the function which is only set if the function was found
+*name: The name of the function
+**param_types: The parameters used within the function
+param_count: The number of parameters used by the function
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self', 'found', 'dest' or 'name' is set to NULL
+*/
+inst_error_t *fhand_try_get_function(prog_hand_t *prog_handler, funct_hand_t *self, bool *found,
+        function_t **dest, char *name, class_t **param_types, int param_count);
+
 /*
 Returns whether the function exists in the Function Handler and if it does, returns a
 reference to the node before that function
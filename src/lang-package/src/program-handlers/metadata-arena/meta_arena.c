@@ -0,0 +1,98 @@
+/*
+Metadata Arena
+By Ciaran Gruber
+
+The Metadata Arena is a bump allocator used for the metadata of classes and functions such as their
+names, parameter types and the nodes of their handlers. The metadata lasts for the whole program so
+it is allocated in large chunks and freed at once along with the program handler
+
+File-specific:
+Metadata Arena - Code File
+The code used to provide for the implementation of a Metadata Arena
+*/
+
+#include <string.h>
+#include "meta_arena.h"
+#include "../program-handler/program_handler.h"
+
+/* The size of the header of each chunk, rounded up so that allocations stay aligned */
+#define CHUNK_HEADER_SIZE ((sizeof(arena_chunk_t) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+
+static arena_chunk_t *__new_chunk(size_t size);
+static void __free_chunks(arena_chunk_t *chunk);
+
+void free_meta_arena(meta_arena_t *src) {
+    if (src == NULL) return;
+
+    __free_chunks(src->current);
+    __free_chunks(src->large);
+    free(src);
+}
+
+void init_meta_arena(meta_arena_t *src) {
+    src->current = NULL;
+    src->large = NULL;
+}
+
+void *arena_alloc(prog_hand_t *prog_handler, size_t size) {
+    meta_arena_t *arena = prog_handler->meta_arena;
+    size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+
+    // Large allocations are given their own chunk so that the current chunk is not wasted
+    if (size > ARENA_CHUNK_SIZE/4) {
+        arena_chunk_t *chunk = __new_chunk(size);
+        if (chunk == NULL) return NULL;
+        chunk->used = size;
+        chunk->next = arena->large;
+        arena->large = chunk;
+        return (char *)chunk + CHUNK_HEADER_SIZE;
+    }
+
+    arena_chunk_t *chunk = arena->current;
+    if (chunk == NULL || chunk->size - chunk->used < size) {
+        chunk = __new_chunk(ARENA_CHUNK_SIZE - CHUNK_HEADER_SIZE);
+        if (chunk == NULL) return NULL;
+        chunk->next = arena->current;
+        arena->current = chunk;
+    }
+    void *dest = (char *)chunk + CHUNK_HEADER_SIZE + chunk->used;
+    chunk->used += size;
+    return dest;
+}
+
+char *arena_copy_str(prog_hand_t *prog_handler, char *src) {
+    size_t length = strlen(src) + 1;
+    char *dest = (char *)arena_alloc(prog_handler, length*sizeof(char));
+    if (dest == NULL) return NULL;
+    memcpy(dest, src, length*sizeof(char));
+    return dest;
+}
+
+/*
+Allocates a new chunk that has no allocations
+
+size: The number of bytes that may be allocated from the chunk
+
+Returns: The new chunk or NULL if there is not enough memory
+*/
+static arena_chunk_t *__new_chunk(size_t size) {
+    arena_chunk_t *chunk = (arena_chunk_t *)malloc(CHUNK_HEADER_SIZE + size);
+    if (chunk == NULL) return NULL;
+    chunk->next = NULL;
+    chunk->used = 0;
+    chunk->size = size;
+    return chunk;
+}
+
+/*
+Frees a list of chunks
+
+*chunk: The first chunk in the list
+*/
+static void __free_chunks(arena_chunk_t *chunk) {
+    while (chunk != NULL) {
+        arena_chunk_t *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+}
\ No newline at end of file
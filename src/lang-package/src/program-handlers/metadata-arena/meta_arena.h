@@ -0,0 +1,76 @@
+/*
+Metadata Arena
+By Ciaran Gruber
+
+The Metadata Arena is a bump allocator used for the metadata of classes and functions such as their
+names, parameter types and the nodes of their handlers. The metadata lasts for the whole program so
+it is allocated in large chunks and freed at once along with the program handler
+
+File-specific:
+Metadata Arena - Header File
+The structures used to represent a Metadata Arena
+*/
+
+#ifndef META_ARENA
+#define META_ARENA
+
+#include <stddef.h>
+#include "../../typedefs.h"
+
+/* The size of each chunk that metadata is allocated from */
+#define ARENA_CHUNK_SIZE 16384
+/* The alignment of every allocation from the arena */
+#define ARENA_ALIGN 16
+
+typedef struct arena_chunk arena_chunk_t;
+
+/* A chunk of memory that allocations are bumped from */
+struct arena_chunk {
+    arena_chunk_t *next; // The chunk allocated before this one
+    size_t used;         // The number of bytes of the chunk that have been allocated
+    size_t size;         // The number of bytes that may be allocated from the chunk
+};
+
+/* A structure that holds the chunks of a Metadata Arena */
+struct gen_meta_arena {
+    arena_chunk_t *current; // The chunk that allocations are currently bumped from
+    arena_chunk_t *large;   // The chunks holding a single allocation too large for a normal chunk
+};
+
+/*
+Frees the memory occupied by a Metadata Arena structure including every chunk and so every piece of
+metadata that was allocated from it
+
+*src: The Metadata Arena structure whose memory is to be freed
+*/
+void free_meta_arena(meta_arena_t *src);
+
+/*
+Initialises the Metadata Arena structure without allocating any chunks
+
+*src: The Metadata Arena to initialise
+*/
+void init_meta_arena(meta_arena_t *src);
+
+/*
+Allocates memory for metadata from the Metadata Arena. The memory can not be freed on its own and
+lasts until the program handler is freed
+
+*prog_handler: The program handler that contains the Metadata Arena
+size: The number of bytes needed
+
+Returns: The allocated memory or NULL if there is not enough memory
+*/
+void *arena_alloc(prog_hand_t *prog_handler, size_t size);
+
+/*
+Copies a string into the Metadata Arena
+
+*prog_handler: The program handler that contains the Metadata Arena
+*src: The string to copy
+
+Returns: The copied string or NULL if there is not enough memory
+*/
+char *arena_copy_str(prog_hand_t *prog_handler, char *src);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,198 @@
+/*
+Method Cache
+By Ciaran Gruber
+
+The Method Cache is a program-wide cache of the Functions that have been found for a class,
+selector and set of parameter classes so that functions run on many different classes do not need
+to be found in the method tables each time
+
+File-specific:
+Method Cache - Code File
+The code used to provide for the implementation of a Method Cache
+*/
+
+#include "method_cache.h"
+#include "../error-handler/error_handler.h"
+#include "../program-handler/program_handler.h"
+#include "../name-hash/name_hash.h"
+
+/* The number of entries in the Method Cache - Must be a power of two */
+#define MCACHE_CAPACITY 1024
+
+static unsigned long __hash_key(bool is_static, int class_id, int selector,
+        class_t **param_types, int param_count);
+static mcache_entry_t *__get_entry(method_cache_t *self, bool is_static, class_t *cls,
+        int selector, class_t **param_types, int param_count);
+static mcache_entry_t *__set_entry(method_cache_t *self, bool is_static, class_t *cls,
+        int selector, class_t **param_types, int param_count);
+
+void free_mcache(method_cache_t *src) {
+    if (src == NULL) return;
+
+    free(src->entries);
+    free(src);
+}
+
+void init_mcache(method_cache_t *src) {
+    // Entries are only used if their epoch matches so epoch 0 marks an unused entry
+    src->entries = (mcache_entry_t *)calloc(MCACHE_CAPACITY, sizeof(mcache_entry_t));
+    src->capacity = src->entries == NULL ? 0 : MCACHE_CAPACITY;
+    src->epoch = 1;
+}
+
+void mcache_invalidate(prog_hand_t *prog_handler) {
+    method_cache_t *cache = prog_handler->method_cache;
+
+    // Clear entries when the epoch wraps around so that old entries can not become valid again
+    cache->epoch++;
+    if (cache->epoch == 0) {
+        for (int i = 0; i < cache->capacity; i++) {
+            cache->entries[i].epoch = 0;
+        }
+        cache->epoch = 1;
+    }
+}
+
+inst_error_t *mcache_get_function(prog_hand_t *prog_handler, bool *result, function_t **dest,
+        class_t *self, int selector, class_t **param_types, int param_count) {
+    if (result == NULL || dest == NULL || self == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    mcache_entry_t *entry = __get_entry(prog_handler->method_cache, false, self, selector,
+                                        param_types, param_count);
+    *result = entry != NULL;
+    if (*result) {
+        *dest = entry->function;
+    }
+    return NULL;
+}
+
+inst_error_t *mcache_add_function(prog_hand_t *prog_handler, function_t *function, class_t *self,
+        class_t **param_types, int param_count) {
+    if (function == NULL || self == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    mcache_entry_t *entry = __set_entry(prog_handler->method_cache, false, self,
+                                        function->selector, param_types, param_count);
+    if (entry != NULL) {
+        entry->function = function;
+        entry->s_function = NULL;
+    }
+    return NULL;
+}
+
+inst_error_t *mcache_get_s_function(prog_hand_t *prog_handler, bool *result, s_function_t **dest,
+        class_t *self, int selector, class_t **param_types, int param_count) {
+    if (result == NULL || dest == NULL || self == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    mcache_entry_t *entry = __get_entry(prog_handler->method_cache, true, self, selector,
+                                        param_types, param_count);
+    *result = entry != NULL;
+    if (*result) {
+        *dest = entry->s_function;
+    }
+    return NULL;
+}
+
+inst_error_t *mcache_add_s_function(prog_hand_t *prog_handler, s_function_t *function,
+        class_t *self, class_t **param_types, int param_count) {
+    if (function == NULL || self == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    mcache_entry_t *entry = __set_entry(prog_handler->method_cache, true, self,
+                                        function->selector, param_types, param_count);
+    if (entry != NULL) {
+        entry->function = NULL;
+        entry->s_function = function;
+    }
+    return NULL;
+}
+
+/*
+Hashes the key of an entry using the FNV-1a algorithm over the class ID, selector and the class IDs
+of the parameters
+
+is_static: Whether the key is for a Static Function
+class_id: The ID of the class
+selector: The selector of the name of the function
+**param_types: The classes of the parameters
+param_count: The number of parameters
+
+Returns: The hash of the key
+*/
+static unsigned long __hash_key(bool is_static, int class_id, int selector,
+        class_t **param_types, int param_count) {
+    unsigned long hash = FNV_OFFSET_BASIS;
+    hash = (hash ^ (unsigned long)is_static) * FNV_PRIME;
+    hash = (hash ^ (unsigned long)class_id) * FNV_PRIME;
+    hash = (hash ^ (unsigned long)selector) * FNV_PRIME;
+    for (int i = 0; i < param_count; i++) {
+        hash = (hash ^ (unsigned long)param_types[i]->class_id) * FNV_PRIME;
+    }
+    return hash;
+}
+
+/*
+Gets the entry that matches the given key if it is in the cache
+
+*self: The Method Cache to search
+is_static: Whether the key is for a Static Function
+*cls: The class the function was found for
+selector: The selector of the name of the function
+**param_types: The classes of the parameters
+param_count: The number of parameters
+
+Returns: The matching entry or NULL if the key is not cached
+*/
+static mcache_entry_t *__get_entry(method_cache_t *self, bool is_static, class_t *cls,
+        int selector, class_t **param_types, int param_count) {
+    if (self->capacity == 0 || param_count > MCACHE_MAX_PARAMS) return NULL;
+
+    unsigned long hash = __hash_key(is_static, cls->class_id, selector, param_types, param_count);
+    mcache_entry_t *entry = &(self->entries[hash & (self->capacity - 1)]);
+
+    // Check the full key as different keys may share the same position
+    if (entry->epoch != self->epoch || entry->is_static != is_static ||
+            entry->class_id != cls->class_id || entry->selector != selector ||
+            entry->param_count != param_count) {
+        return NULL;
+    }
+    for (int i = 0; i < param_count; i++) {
+        if (entry->param_ids[i] != param_types[i]->class_id) return NULL;
+    }
+    return entry;
+}
+
+/*
+Sets the key of the entry at the position for the given key, replacing any existing entry
+
+*self: The Method Cache to add to
+is_static: Whether the key is for a Static Function
+*cls: The class the function was found for
+selector: The selector of the name of the function
+**param_types: The classes of the parameters
+param_count: The number of parameters
+
+Returns: The entry whose function is to be set or NULL if the key can not be cached
+*/
+static mcache_entry_t *__set_entry(method_cache_t *self, bool is_static, class_t *cls,
+        int selector, class_t **param_types, int param_count) {
+    if (self->capacity == 0 || param_count > MCACHE_MAX_PARAMS) return NULL;
+
+    unsigned long hash = __hash_key(is_static, cls->class_id, selector, param_types, param_count);
+    mcache_entry_t *entry = &(self->entries[hash & (self->capacity - 1)]);
+    entry->epoch = self->epoch;
+    entry->is_static = is_static;
+    entry->class_id = cls->class_id;
+    entry->selector = selector;
+    entry->param_count = param_count;
+    for (int i = 0; i < param_count; i++) {
+        entry->param_ids[i] = param_types[i]->class_id;
+    }
+    return entry;
+}
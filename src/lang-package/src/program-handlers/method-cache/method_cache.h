@@ -0,0 +1,138 @@
+/*
+Method Cache
+By Ciaran Gruber
+
+The Method Cache is a program-wide cache of the Functions that have been found for a class,
+selector and set of parameter classes so that functions run on many different classes do not need
+to be found in the method tables each time
+
+File-specific:
+Method Cache - Header File
+The structures used to represent a Method Cache
+*/
+
+#ifndef METHOD_CACHE
+#define METHOD_CACHE
+
+#include "../../typedefs.h"
+
+/* The maximum number of parameters a function may have for it to be cached */
+#define MCACHE_MAX_PARAMS 4
+
+typedef struct mcache_entry mcache_entry_t;
+
+/* An entry in the Method Cache containing a Function and the key it was found with */
+struct mcache_entry {
+    unsigned int epoch;                // The epoch the entry was added in - 0 if never used
+    bool is_static;                    // Whether the entry holds a Static Function
+    int class_id;                      // The ID of the class the Function was found for
+    int selector;                      // The selector of the name of the Function
+    int param_count;                   // The number of parameters the Function was found for
+    int param_ids[MCACHE_MAX_PARAMS];  // The class IDs of the parameters
+    function_t *function;              // The Function if the entry is not static
+    s_function_t *s_function;          // The Static Function if the entry is static
+};
+
+/* A structure that holds the Functions that have been found for each class */
+struct gen_method_cache {
+    mcache_entry_t *entries; // The entries in the cache - Always a power of two in size
+    int capacity;            // The number of entries in the cache
+    /*
+    The current epoch of the cache. Entries from an earlier epoch are ignored so that the whole
+    cache can be cleared by incrementing the epoch whenever a function is added or removed
+    */
+    unsigned int epoch;
+};
+
+/*
+Frees the memory occupied by a Method Cache structure. The Functions within the cache are owned by
+the Function Handlers of each class and are not freed
+
+*src: The Method Cache structure whose memory is to be freed
+*/
+void free_mcache(method_cache_t *src);
+
+/*
+Initialises the Method Cache structure by allocating its entries
+
+*src: The Method Cache to initialise
+*/
+void init_mcache(method_cache_t *src);
+
+/*
+Invalidates every entry in the Method Cache. This must be done whenever a function is added to or
+removed from any class
+
+*prog_handler: The program handler that contains the Method Cache
+*/
+void mcache_invalidate(prog_hand_t *prog_handler);
+
+/*
+Gets a Function from the Method Cache based upon the class, selector and parameters it was found
+for
+
+*prog_handler: The program handler that contains the Method Cache
+*result: A pointer to the boolean where whether the Function was cached is stored
+**dest: A pointer to the Function if it was cached
+*self: The class to get the Function for
+selector: The selector of the name of the Function
+**param_types: The classes of the parameters
+param_count: The number of parameters
+
+Errors:
+    ErrInvalidParameters: Thrown if 'result', 'dest' or 'self' is set to NULL
+*/
+inst_error_t *mcache_get_function(prog_hand_t *prog_handler, bool *result, function_t **dest,
+        class_t *self, int selector, class_t **param_types, int param_count);
+
+/*
+Adds a Function to the Method Cache, replacing any entry that uses the same position. Functions
+with more than MCACHE_MAX_PARAMS parameters are not cached
+
+*prog_handler: The program handler that contains the Method Cache
+*function: The Function to cache
+*self: The class the Function was found for
+**param_types: The classes of the parameters the Function was found for
+param_count: The number of parameters
+
+Errors:
+    ErrInvalidParameters: Thrown if 'function' or 'self' is set to NULL
+*/
+inst_error_t *mcache_add_function(prog_hand_t *prog_handler, function_t *function, class_t *self,
+        class_t **param_types, int param_count);
+
+/*
+Gets a Static Function from the Method Cache based upon the class, selector and parameters it was
+found for
+
+*prog_handler: The program handler that contains the Method Cache
+*result: A pointer to the boolean where whether the Static Function was cached is stored
+**dest: A pointer to the Static Function if it was cached
+*self: The class to get the Static Function for
+selector: The selector of the name of the Static Function
+**param_types: The classes of the parameters
+param_count: The number of parameters
+
+Errors:
+    ErrInvalidParameters: Thrown if 'result', 'dest' or 'self' is set to NULL
+*/
+inst_error_t *mcache_get_s_function(prog_hand_t *prog_handler, bool *result, s_function_t **dest,
+        class_t *self, int selector, class_t **param_types, int param_count);
+
+/*
+Adds a Static Function to the Method Cache, replacing any entry that uses the same position. Static
+Functions with more than MCACHE_MAX_PARAMS parameters are not cached
+
+*prog_handler: The program handler that contains the Method Cache
+*function: The Static Function to cache
+*self: The class the Static Function was found for
+**param_types: The classes of the parameters the Static Function was found for
+param_count: The number of parameters
+
+Errors:
+    ErrInvalidParameters: Thrown if 'function' or 'self' is set to NULL
+*/
+inst_error_t *mcache_add_s_function(prog_hand_t *prog_handler, s_function_t *function,
+        class_t *self, class_t **param_types, int param_count);
+
+#endif
@@ -0,0 +1,244 @@
+/*
+Method Table
+By Ciaran Gruber
+
+The Method Table is a flattened table of every Function that can be run by instances of a class,
+including those inherited from parent classes, so that a function can be found without searching
+each parent class
+
+File-specific:
+Method Table - Code File
+The code used to provide for the implementation of a Method Table
+*/
+
+#include <string.h>
+#include "method_table.h"
+#include "../error-handler/error_handler.h"
+#include "../selector-handler/selector_handler.h"
+#include "../../base-program/function/function.h"
+
+/* The number of entries initially allocated for a Method Table */
+#define INITIAL_CAPACITY 8
+
+static mtable_entry_t *__find_entry(method_table_t *self, int selector);
+static bool __resize_entries(method_table_t *self, int capacity);
+static bool __has_same_params(function_t *function, function_t *other);
+
+void free_mtable(method_table_t *src) {
+    if (src == NULL) return;
+
+    for (int i = 0; i < src->capacity; i++) {
+        free(src->entries[i].functions);
+    }
+    free(src->entries);
+    free(src);
+}
+
+inst_error_t *new_mtable(prog_hand_t *prog_handler, method_table_t *dest) {
+    if (dest == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    dest->entries = NULL;
+    dest->entry_count = 0;
+    dest->capacity = 0;
+    return NULL;
+}
+
+inst_error_t *mtable_inherit(prog_hand_t *prog_handler, method_table_t *self, method_table_t *src) {
+    inst_error_t *error;
+    if (self == NULL || src == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    // Add functions in reverse so that each entry keeps the same order as the source table
+    for (int i = 0; i < src->capacity; i++) {
+        mtable_entry_t *entry = &(src->entries[i]);
+        for (int j = entry->function_count - 1; j >= 0; j--) {
+            error = mtable_add_function(prog_handler, self, entry->functions[j]);
+            if (error != NULL) return error;
+        }
+    }
+    return NULL;
+}
+
+inst_error_t *mtable_add_function(prog_hand_t *prog_handler, method_table_t *self,
+        function_t *function) {
+    if (self == NULL || function == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    // Keep the table at most half full so that probes stay short
+    if ((self->entry_count + 1) * 2 > self->capacity) {
+        int capacity = self->capacity == 0 ? INITIAL_CAPACITY : self->capacity * 2;
+        if (!__resize_entries(self, capacity)) {
+            return new_error(prog_handler, "ErrOutOfMemory");
+        }
+    }
+
+    // Find entry, creating it if it does not exist
+    mtable_entry_t *entry = __find_entry(self, function->selector);
+    if (entry->selector == -1) {
+        entry->selector = function->selector;
+        self->entry_count++;
+    }
+
+    // Replace a function with the same parameters as it is being overridden
+    for (int i = 0; i < entry->function_count; i++) {
+        if (__has_same_params(entry->functions[i], function)) {
+            entry->functions[i] = function;
+            return NULL;
+        }
+    }
+
+    // Grow function list if required
+    if (entry->function_count == entry->function_capacity) {
+        int new_capacity = entry->function_capacity * 2 + 2;
+        function_t **functions = (function_t **)realloc(entry->functions,
+                                                        new_capacity*sizeof(function_t *));
+        if (functions == NULL) {
+            return new_error(prog_handler, "ErrOutOfMemory");
+        }
+        entry->functions = functions;
+        entry->function_capacity = new_capacity;
+    }
+    // Add function to start so that it is checked before any inherited functions
+    memmove(entry->functions + 1, entry->functions, entry->function_count*sizeof(function_t *));
+    entry->functions[0] = function;
+    entry->function_count++;
+    return NULL;
+}
+
+inst_error_t *mtable_get_function(prog_hand_t *prog_handler, method_table_t *self,
+        function_t **dest, char *name, class_t **param_types, int param_count) {
+    inst_error_t *error;
+    if (self == NULL || dest == NULL || name == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    // A function can not exist if its name has never been interned
+    bool sel_exists;
+    int selector;
+    error = selector_exists(prog_handler, &sel_exists, &selector, name);
+    if (error != NULL) return error;
+    if (!sel_exists) {
+        return new_error(prog_handler, "ErrFunctionNotDefined");
+    }
+
+    return mtable_get_function_sel(prog_handler, self, dest, selector, param_types, param_count);
+}
+
+inst_error_t *mtable_get_function_sel(prog_hand_t *prog_handler, method_table_t *self,
+        function_t **dest, int selector, class_t **param_types, int param_count) {
+    inst_error_t *error;
+    if (self == NULL || dest == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    // Attempt to get function
+    bool found;
+    error = mtable_try_get_function_sel(prog_handler, self, &found, dest, selector, param_types,
+                                        param_count);
+    if (error != NULL) return error;
+    if (!found) {
+        return new_error(prog_handler, "ErrFunctionNotDefined");
+    }
+    return NULL;
+}
+
+inst_error_t *mtable_try_get_function_sel(prog_hand_t *prog_handler, method_table_t *self,
+        bool *found, function_t **dest, int selector, class_t **param_types, int param_count) {
+    if (self == NULL || found == NULL || dest == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+    *found = false;
+
+    // Get entry
+    mtable_entry_t *entry = __find_entry(self, selector);
+    if (entry == NULL || entry->selector == -1) return NULL;
+
+    // Find the function that matches the parameters
+    bool is_equal;
+    for (int i = 0; i < entry->function_count; i++) {
+        is_function_equal(prog_handler, &is_equal, entry->functions[i], param_types, param_count);
+        if (is_equal) {
+            *dest = entry->functions[i];
+            *found = true;
+            return NULL;
+        }
+    }
+    return NULL;
+}
+
+/*
+Finds the entry for the given selector or the unused entry where it would be placed
+
+*self: The Method Table to search
+selector: The selector of the Functions in the entry
+
+Returns: The entry for the selector, an unused entry if the selector is not in the table, or NULL
+         if the table has no entries
+*/
+static mtable_entry_t *__find_entry(method_table_t *self, int selector) {
+    if (self->capacity == 0) return NULL;
+
+    // Selectors are small sequential integers so they are used directly as the starting position
+    int mask = self->capacity - 1;
+    int index = selector & mask;
+    while (self->entries[index].selector != -1) {
+        if (self->entries[index].selector == selector) {
+            break;
+        }
+        index = (index + 1) & mask;
+    }
+    return &(self->entries[index]);
+}
+
+/*
+Resizes the entries in the Method Table, moving all existing entries into their new positions
+
+*self: The Method Table to resize
+capacity: The new number of entries - Must be a power of two
+
+Returns: Whether the entries could be allocated. The existing entries are kept on failure
+*/
+static bool __resize_entries(method_table_t *self, int capacity) {
+    mtable_entry_t *entries = (mtable_entry_t *)calloc(capacity, sizeof(mtable_entry_t));
+    if (entries == NULL) return false;
+    for (int i = 0; i < capacity; i++) {
+        entries[i].selector = -1;
+    }
+
+    // Move entries into new positions
+    for (int i = 0; i < self->capacity; i++) {
+        mtable_entry_t *entry = &(self->entries[i]);
+        if (entry->selector == -1) continue;
+
+        int index = entry->selector & (capacity - 1);
+        while (entries[index].selector != -1) {
+            index = (index + 1) & (capacity - 1);
+        }
+        entries[index] = *entry;
+    }
+    free(self->entries);
+    self->entries = entries;
+    self->capacity = capacity;
+    return true;
+}
+
+/*
+Checks whether two Functions have exactly the same parameter types
+
+*function: The first Function to compare
+*other: The second Function to compare
+
+Returns: Whether the parameter types are the same
+*/
+static bool __has_same_params(function_t *function, function_t *other) {
+    if (function->param_count != other->param_count) return false;
+
+    for (int i = 0; i < function->param_count; i++) {
+        if (function->param_types[i] != other->param_types[i]) return false;
+    }
+    return true;
+}
@@ -0,0 +1,136 @@
+/*
+Method Table
+By Ciaran Gruber
+
+The Method Table is a flattened table of every Function that can be run by instances of a class,
+including those inherited from parent classes, so that a function can be found without searching
+each parent class
+
+File-specific:
+Method Table - Header File
+The structures used to represent a Method Table
+*/
+
+#ifndef METHOD_TABLE
+#define METHOD_TABLE
+
+#include "../../typedefs.h"
+
+typedef struct mtable_entry mtable_entry_t;
+
+/* An entry in the Method Table that contains every Function with the same selector */
+struct mtable_entry {
+    int selector;           // The selector of the Functions in the entry - Set to -1 if unused
+    function_t **functions; // The Functions with the selector, with overriding Functions first
+    int function_count;     // The number of Functions in the entry
+    int function_capacity;  // The number of Functions that can be stored before resizing
+};
+
+/* A structure that holds the Functions available to instances of a class */
+struct gen_method_table {
+    mtable_entry_t *entries; // The entries in the table
+    int entry_count;         // The number of used entries in the table
+    int capacity;            // The number of entries in the table - Always a power of two
+};
+
+/*
+Frees the memory occupied by a Method Table structure. The Functions within the table are owned by
+the Function Handlers of each class and are not freed
+
+*src: The Method Table structure whose memory is to be freed
+*/
+void free_mtable(method_table_t *src);
+
+/*
+Creates a new Method Table by resetting the source variable
+
+*prog_handler: The program handler that contains the class and error handlers
+*dest: The pointer to the Method Table to initialise
+
+Errors:
+    ErrInvalidParameters: Thrown if 'dest' is set to NULL
+*/
+inst_error_t *new_mtable(prog_hand_t *prog_handler, method_table_t *dest);
+
+/*
+Copies every Function from one Method Table into another, typically used to inherit the Functions
+from a parent class
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The Method Table to copy the Functions into
+*src: The Method Table to copy the Functions from
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self' or 'src' is set to NULL
+    ErrOutOfMemory: Thrown if there is not enough memory to copy the Functions
+*/
+inst_error_t *mtable_inherit(prog_hand_t *prog_handler, method_table_t *self, method_table_t *src);
+
+/*
+Adds a Function to the Method Table, replacing any Function that has the same name and parameter
+types so that the given Function overrides it
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The Method Table to add the Function to
+*function: The Function to add to the Method Table
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self' or 'function' is set to NULL
+    ErrOutOfMemory: Thrown if there is not enough memory to add the Function
+*/
+inst_error_t *mtable_add_function(prog_hand_t *prog_handler, method_table_t *self,
+        function_t *function);
+
+/*
+Gets a Function from the Method Table based upon the name and parameters
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The Method Table to get the Function from
+**dest: A pointer to the Function
+*name: The name of the Function
+**param_types: The parameters used within the Function
+param_count: The number of parameters used by the Function
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self', 'dest' or 'name' is set to NULL
+    ErrFunctionNotDefined: Thrown if the Function could not be found
+*/
+inst_error_t *mtable_get_function(prog_hand_t *prog_handler, method_table_t *self,
+        function_t **dest, char *name, class_t **param_types, int param_count);
+
+/*
+Gets a Function from the Method Table based upon the selector of its name and parameters
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The Method Table to get the Function from
+**dest: A pointer to the Function
+selector: The selector of the name of the Function
+**param_types: The parameters used within the Function
+param_count: The number of parameters used by the Function
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self' or 'dest' is set to NULL
+    ErrFunctionNotDefined: Thrown if the Function could not be found
+*/
+inst_error_t *mtable_get_function_sel(prog_hand_t *prog_handler, method_table_t *self,
+        function_t **dest, int selector, class_t **param_types, int param_count);
+
+/*
+Gets a Function from the Method Table based upon the selector of its name and parameters without
+throwing an error if the Function could not be found
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The Method Table to get the Function from
+*found: A boolean value representing whether the Function was found
+**dest: A pointer to the Function which is only set if the Function was found
+selector: The selector of the name of the Function
+**param_types: The parameters used within the Function
+param_count: The number of parameters used by the Function
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self', 'found' or 'dest' is set to NULL
+*/
+inst_error_t *mtable_try_get_function_sel(prog_hand_t *prog_handler, method_table_t *self,
+        bool *found, function_t **dest, int selector, class_t **param_types, int param_count);
+
+#endif
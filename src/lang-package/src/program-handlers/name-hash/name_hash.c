@@ -0,0 +1,22 @@
+/*
+Name Hash
+By Ciaran Gruber
+
+The Name Hash is the FNV-1a hash shared by the handlers that find classes, selectors and cached
+functions using a hash table
+
+File-specific:
+Name Hash - Code File
+The code used to provide for the implementation of the Name Hash
+*/
+
+#include "name_hash.h"
+
+unsigned long hash_name(char *name) {
+    unsigned long hash = FNV_OFFSET_BASIS;
+    while (*name != '\0') {
+        hash ^= (unsigned char)*name++;
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+/*
+Name Hash
+By Ciaran Gruber
+
+The Name Hash is the FNV-1a hash shared by the handlers that find classes, selectors and cached
+functions using a hash table
+
+File-specific:
+Name Hash - Header File
+The constants and functions used to hash names and keys
+*/
+
+#ifndef NAME_HASH
+#define NAME_HASH
+
+/* The value that every FNV-1a hash begins with */
+#define FNV_OFFSET_BASIS 2166136261UL
+/* The prime that the hash is multiplied by after each byte or value is mixed in */
+#define FNV_PRIME 16777619UL
+
+/*
+Hashes a name using the FNV-1a algorithm
+
+*name: The name to hash
+
+Returns: The hash of the name
+*/
+unsigned long hash_name(char *name);
+
+#endif
\ No newline at end of file
@@ -13,18 +13,49 @@ The code used to provide for the implementation of a Program Handler
 #include "program_handler.h"
 #include "../class-handler/class_handler.h"
 #include "../error-handler/error_handler.h"
+#include "../selector-handler/selector_handler.h"
+#include "../method-cache/method_cache.h"
+#include "../variable-pool/var_pool.h"
+#include "../metadata-arena/meta_arena.h"
+#include "../region/region.h"
+#include "../collector/collector.h"
 
 void free_prog_hand(prog_hand_t *src) {
     if (src == NULL) return;
 
+    // Tracked variables are freed first while the classes they are instances of still exist
+    free_collector(src->collector);
     free_cls_hand(src->cls_handler);
     free_err_hand(src->err_handler);
+    free_sel_hand(src->sel_handler);
+    free_mcache(src->method_cache);
+    // Discard any regions that have not ended before the pool their variables came from
+    free_region(src->region);
+    // Freed after the handlers as the classes within them hold blocks from the pool
+    free_var_pool(src->var_pool);
+    // The metadata of every class is freed at once after the classes no longer use it
+    free_meta_arena(src->meta_arena);
     free(src);
 }
 
 void init_prog_hand(prog_hand_t *src) {
     src->cls_handler = (cls_hand_t *)malloc(sizeof(cls_hand_t));
     src->err_handler = (err_hand_t *)malloc(sizeof(err_hand_t));
+    src->sel_handler = (sel_hand_t *)malloc(sizeof(sel_hand_t));
+    src->method_cache = (method_cache_t *)malloc(sizeof(method_cache_t));
+    src->var_pool = (var_pool_t *)malloc(sizeof(var_pool_t));
+    src->meta_arena = (meta_arena_t *)malloc(sizeof(meta_arena_t));
+    src->region = (region_t *)malloc(sizeof(region_t));
+    src->collector = (collector_t *)malloc(sizeof(collector_t));
     init_cls_hand(src->cls_handler);
     init_err_hand(src->err_handler);
+    init_sel_hand(src->sel_handler);
+    init_mcache(src->method_cache);
+    init_var_pool(src->var_pool);
+    init_meta_arena(src->meta_arena);
+    init_region(src->region);
+    init_collector(src->collector);
+    for (int i = 0; i < IMM_TAG_COUNT; i++) {
+        src->imm_classes[i] = NULL;
+    }
 }
\ No newline at end of file
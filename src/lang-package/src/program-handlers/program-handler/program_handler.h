@@ -17,19 +17,27 @@ The structures used to handle the program
 
 /* A structure containing all the handlers required for the program */
 struct gen_prog_hand {
-    cls_hand_t *cls_handler; // The class handler for the program
-    err_hand_t *err_handler; // The error handler for the program
+    cls_hand_t *cls_handler;      // The class handler for the program
+    err_hand_t *err_handler;      // The error handler for the program
+    sel_hand_t *sel_handler;      // The selector handler used to intern function names
+    method_cache_t *method_cache; // The cache of Functions found for each class
+    var_pool_t *var_pool;         // The pool that the parts of variables are allocated from
+    meta_arena_t *meta_arena;     // The arena that the metadata of classes is allocated from
+    region_t *region;             // The scratch memory of regions that have begun
+    collector_t *collector;       // The tracing collector of variables created with gc_new_var
+    class_t *imm_classes[IMM_TAG_COUNT]; // The class of immediates with each tag
 };
 
 /*
-Frees the memory that a Program Handler takes including the class and error handlers
+Frees the memory that a Program Handler takes including its handlers and caches. Every variable
+allocated from its Variable Pool must be freed before the Program Handler
 
 *src: The Program Handler to clear
 */
 void free_prog_hand(prog_hand_t *src);
 
 /*
-Initialises the Program Handler by initialising the class handler and the error handlers
+Initialises the Program Handler by initialising its handlers and caches
 
 *src: The Program Handler to initialise
 */
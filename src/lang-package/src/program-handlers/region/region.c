@@ -0,0 +1,179 @@
+/*
+Region
+By Ciaran Gruber
+
+A Region is a scope of scratch work, such as handling a single request, in which every part of a
+variable is bumped from a chunk of memory instead of the Variable Pool. Everything allocated within
+the region is discarded together when it ends so temporary variables do not need to be freed one by
+one. Regions may be nested and chunks are kept when a region ends so that later regions reuse them
+
+File-specific:
+Region - Code File
+The code used to provide for the implementation of a Region
+*/
+
+#include "region.h"
+#include "../error-handler/error_handler.h"
+#include "../program-handler/program_handler.h"
+#include "../../base-program/variable/var_description.h"
+
+/* The size of the header of each chunk, rounded up so that allocations stay aligned */
+#define CHUNK_HEADER_SIZE \
+    ((sizeof(region_chunk_t) + REGION_ALIGN - 1) & ~(size_t)(REGION_ALIGN - 1))
+
+static region_chunk_t *__new_chunk(size_t size);
+
+void free_region(region_t *src) {
+    if (src == NULL) return;
+
+    region_chunk_t *chunk = src->first;
+    while (chunk != NULL) {
+        region_chunk_t *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    chunk = src->large;
+    while (chunk != NULL) {
+        region_chunk_t *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    free(src);
+}
+
+void init_region(region_t *src) {
+    src->first = NULL;
+    src->current = NULL;
+    src->large = NULL;
+    src->top = NULL;
+    src->fields = NULL;
+}
+
+inst_error_t *region_begin(prog_hand_t *prog_handler) {
+    region_t *region = prog_handler->region;
+
+    // Store the position before the mark is allocated so that ending the region also discards it
+    region_chunk_t *chunk = region->current;
+    size_t used = chunk != NULL ? chunk->used : 0;
+    region_mark_t *mark = (region_mark_t *)region_alloc(prog_handler, sizeof(region_mark_t));
+    if (mark == NULL) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+    mark->prev = region->top;
+    mark->chunk = chunk;
+    mark->used = used;
+    mark->large = region->large;
+    mark->fields = region->fields;
+    region->top = mark;
+    return NULL;
+}
+
+inst_error_t *region_end(prog_hand_t *prog_handler) {
+    region_t *region = prog_handler->region;
+    region_mark_t *mark = region->top;
+    if (mark == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    // Member fields freed within the region have already released their descriptions
+    while (region->fields != mark->fields) {
+        inst_fields_t *block = region->fields->block;
+        for (int i = 0; i < block->field_count; i++) {
+            free_var_desc(block->fields[i].desc);
+        }
+        block->field_count = 0;
+        region->fields = region->fields->next;
+    }
+
+    while (region->large != mark->large) {
+        region_chunk_t *next = region->large->next;
+        free(region->large);
+        region->large = next;
+    }
+
+    // Read the mark before resetting the chunk as the mark is stored within it
+    region->top = mark->prev;
+    region->current = mark->chunk != NULL ? mark->chunk : region->first;
+    if (region->current != NULL) {
+        region->current->used = mark->chunk != NULL ? mark->used : 0;
+    }
+    return NULL;
+}
+
+region_mark_t *region_pause(prog_hand_t *prog_handler) {
+    region_mark_t *top = prog_handler->region->top;
+    prog_handler->region->top = NULL;
+    return top;
+}
+
+void region_resume(prog_hand_t *prog_handler, region_mark_t *top) {
+    prog_handler->region->top = top;
+}
+
+bool in_region(prog_hand_t *prog_handler) {
+    return prog_handler->region->top != NULL;
+}
+
+void *region_alloc(prog_hand_t *prog_handler, size_t size) {
+    region_t *region = prog_handler->region;
+    size = (size + REGION_ALIGN - 1) & ~(size_t)(REGION_ALIGN - 1);
+
+    // Large allocations are given their own chunk which is freed when the region ends
+    if (size > REGION_CHUNK_SIZE/4) {
+        region_chunk_t *chunk = __new_chunk(size);
+        if (chunk == NULL) return NULL;
+        chunk->used = size;
+        chunk->next = region->large;
+        region->large = chunk;
+        return (char *)chunk + CHUNK_HEADER_SIZE;
+    }
+
+    region_chunk_t *chunk = region->current;
+    if (chunk == NULL || chunk->size - chunk->used < size) {
+        // Reuse the chunk after the current one if an earlier region already allocated it
+        region_chunk_t *next = chunk != NULL ? chunk->next : region->first;
+        if (next == NULL) {
+            next = __new_chunk(REGION_CHUNK_SIZE - CHUNK_HEADER_SIZE);
+            if (next == NULL) return NULL;
+            if (chunk != NULL) {
+                chunk->next = next;
+            } else {
+                region->first = next;
+            }
+        }
+        next->used = 0;
+        region->current = next;
+        chunk = next;
+    }
+    void *dest = (char *)chunk + CHUNK_HEADER_SIZE + chunk->used;
+    chunk->used += size;
+    return dest;
+}
+
+inst_error_t *region_add_fields(prog_hand_t *prog_handler, inst_fields_t *block) {
+    region_t *region = prog_handler->region;
+    region_fields_t *node = (region_fields_t *)region_alloc(prog_handler, sizeof(region_fields_t));
+    if (node == NULL) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+    node->block = block;
+    node->next = region->fields;
+    region->fields = node;
+    return NULL;
+}
+
+/*
+Allocates a new chunk that has no allocations
+
+size: The number of bytes that may be allocated from the chunk
+
+Returns: The new chunk or NULL if there is not enough memory
+*/
+static region_chunk_t *__new_chunk(size_t size) {
+    region_chunk_t *chunk = (region_chunk_t *)malloc(CHUNK_HEADER_SIZE + size);
+    if (chunk == NULL) return NULL;
+    chunk->next = NULL;
+    chunk->used = 0;
+    chunk->size = size;
+    return chunk;
+}
\ No newline at end of file
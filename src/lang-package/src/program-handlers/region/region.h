@@ -0,0 +1,153 @@
+/*
+Region
+By Ciaran Gruber
+
+A Region is a scope of scratch work, such as handling a single request, in which every part of a
+variable is bumped from a chunk of memory instead of the Variable Pool. Everything allocated within
+the region is discarded together when it ends so temporary variables do not need to be freed one by
+one. Regions may be nested and chunks are kept when a region ends so that later regions reuse them
+
+File-specific:
+Region - Header File
+The structures used to represent a Region
+*/
+
+#ifndef REGION
+#define REGION
+
+#include <stddef.h>
+#include "../../typedefs.h"
+
+/* The size of each chunk that the memory of regions is bumped from */
+#define REGION_CHUNK_SIZE 16384
+/* The alignment of every allocation from a region */
+#define REGION_ALIGN 16
+
+typedef struct region_chunk region_chunk_t;
+typedef struct region_mark region_mark_t;
+typedef struct region_fields region_fields_t;
+
+/* A chunk of memory that allocations are bumped from */
+struct region_chunk {
+    region_chunk_t *next; // The chunk used after this one is full, kept after regions end
+    size_t used;          // The number of bytes of the chunk that have been allocated
+    size_t size;          // The number of bytes that may be allocated from the chunk
+};
+
+/* The position of the memory when a region began, stored in the memory of the region itself */
+struct region_mark {
+    region_mark_t *prev;      // The mark of the region that this region is nested within
+    region_chunk_t *chunk;    // The chunk that was current when the region began
+    size_t used;              // The number of bytes of the chunk that were used
+    region_chunk_t *large;    // The first large chunk when the region began
+    region_fields_t *fields;  // The first member field block when the region began
+};
+
+/*
+A member field block allocated within a region. The descriptions its member fields share with the
+field layout of their class are released when the region ends
+*/
+struct region_fields {
+    region_fields_t *next;  // The member field block allocated before this one
+    inst_fields_t *block;   // The member field block
+};
+
+/* A structure that holds the chunks and marks of every region that has begun */
+struct gen_region {
+    region_chunk_t *first;   // The first chunk
+    region_chunk_t *current; // The chunk that allocations are currently bumped from
+    region_chunk_t *large;   // The chunks holding a single allocation too large for a normal chunk
+    region_mark_t *top;      // The mark of the innermost region - NULL if no region has begun
+    region_fields_t *fields; // The member field blocks allocated within every region
+};
+
+/*
+Frees the memory occupied by a Region structure including every chunk. Any variable allocated
+within a region that has not ended must not be used afterwards
+
+*src: The Region structure whose memory is to be freed
+*/
+void free_region(region_t *src);
+
+/*
+Initialises the Region structure without allocating any chunks or beginning a region
+
+*src: The Region to initialise
+*/
+void init_region(region_t *src);
+
+/*
+Begins a new region. Until the region ends, every new variable, description, member field block and
+block of unmanaged data is allocated within the region instead of the Variable Pool
+
+*prog_handler: The program handler that contains the Region
+
+Errors:
+    ErrOutOfMemory: Thrown if there is not enough memory to begin the region
+*/
+inst_error_t *region_begin(prog_hand_t *prog_handler);
+
+/*
+Ends the innermost region, discarding every variable allocated within it at once. Variables
+allocated within the region may be freed beforehand but must not be used afterwards, and variables
+allocated before the region began must not be initialised within it unless they are also discarded
+
+*prog_handler: The program handler that contains the Region
+
+Errors:
+    ErrInvalidParameters: Thrown if no region has begun
+*/
+inst_error_t *region_end(prog_hand_t *prog_handler);
+
+/*
+Stops allocating within regions until region_resume is called so that memory which must outlast the
+innermost region, such as the prototype of a class, is allocated from the Variable Pool. Any region
+that begins while paused must also end before resuming
+
+*prog_handler: The program handler that contains the Region
+
+Returns: The mark of the innermost region, which is passed to region_resume - NULL if none has begun
+*/
+region_mark_t *region_pause(prog_hand_t *prog_handler);
+
+/*
+Resumes allocating within the regions that were paused by region_pause
+
+*prog_handler: The program handler that contains the Region
+*top: The mark returned by region_pause
+*/
+void region_resume(prog_hand_t *prog_handler, region_mark_t *top);
+
+/*
+Checks whether a region has begun and not yet ended
+
+*prog_handler: The program handler that contains the Region
+
+Returns: Whether allocations are currently made within a region
+*/
+bool in_region(prog_hand_t *prog_handler);
+
+/*
+Allocates memory within the innermost region. The memory can not be freed on its own and lasts until
+the region ends
+
+*prog_handler: The program handler that contains the Region
+size: The number of bytes needed
+
+Returns: The allocated memory or NULL if there is not enough memory
+*/
+void *region_alloc(prog_hand_t *prog_handler, size_t size);
+
+/*
+Records a member field block allocated within the innermost region so that the descriptions of its
+member fields are released when the region ends
+
+*prog_handler: The program handler that contains the Region
+*block: The member field block
+
+Errors:
+    ErrOutOfMemory: Thrown if there is not enough memory to record the block
+*/
+inst_error_t *region_add_fields(prog_hand_t *prog_handler, inst_fields_t *block);
+
+#endif
\ No newline at end of file
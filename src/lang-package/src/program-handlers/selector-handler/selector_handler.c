@@ -0,0 +1,184 @@
+/*
+Selector Handler
+By Ciaran Gruber
+
+The Selector Handler is used to intern the names of functions into integer selectors so that
+functions can be found without comparing their names. The names of member fields are also interned
+as they are shared by every instance of their class
+
+File-specific:
+Selector Handler - Code File
+The code used to provide for the implementation of a Selector Handler
+*/
+
+#include <string.h>
+#include "selector_handler.h"
+#include "../error-handler/error_handler.h"
+#include "../program-handler/program_handler.h"
+#include "../name-hash/name_hash.h"
+
+/* The number of buckets initially allocated for the Selector Handler */
+#define INITIAL_BUCKET_COUNT 64
+
+static int *__find_bucket(sel_hand_t *self, char *name, unsigned long hash);
+static bool __resize_buckets(sel_hand_t *self, int bucket_count);
+
+void free_sel_hand(sel_hand_t *src) {
+    if (src == NULL) return;
+
+    for (int i = 0; i < src->sel_count; i++) {
+        free(src->names[i]);
+    }
+    free(src->names);
+    free(src->hashes);
+    free(src->buckets);
+    free(src);
+}
+
+void init_sel_hand(sel_hand_t *src) {
+    src->names = NULL;
+    src->hashes = NULL;
+    src->buckets = NULL;
+    src->bucket_count = 0;
+    src->sel_count = 0;
+    src->sel_capacity = 0;
+}
+
+inst_error_t *get_selector(prog_hand_t *prog_handler, int *dest, char *name) {
+    if (dest == NULL || name == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+    sel_hand_t *sel_handler = prog_handler->sel_handler;
+
+    // Keep the hash table at most half full so that probes stay short
+    if ((sel_handler->sel_count + 1) * 2 > sel_handler->bucket_count) {
+        int bucket_count = sel_handler->bucket_count == 0 ? INITIAL_BUCKET_COUNT :
+                                                            sel_handler->bucket_count * 2;
+        if (!__resize_buckets(sel_handler, bucket_count)) {
+            return new_error(prog_handler, "ErrOutOfMemory");
+        }
+    }
+
+    // Return the existing selector if the name is already interned
+    unsigned long hash = hash_name(name);
+    int *bucket = __find_bucket(sel_handler, name, hash);
+    if (*bucket != -1) {
+        *dest = *bucket;
+        return NULL;
+    }
+
+    // Grow name list if required
+    if (sel_handler->sel_count == sel_handler->sel_capacity) {
+        int new_capacity = sel_handler->sel_capacity * 2 + INITIAL_BUCKET_COUNT;
+        char **names = (char **)realloc(sel_handler->names, new_capacity*sizeof(char *));
+        if (names == NULL) {
+            return new_error(prog_handler, "ErrOutOfMemory");
+        }
+        sel_handler->names = names;
+        unsigned long *hashes = (unsigned long *)realloc(sel_handler->hashes,
+                                                        new_capacity*sizeof(unsigned long));
+        if (hashes == NULL) {
+            return new_error(prog_handler, "ErrOutOfMemory");
+        }
+        sel_handler->hashes = hashes;
+        sel_handler->sel_capacity = new_capacity;
+    }
+
+    // Copy name
+    char *interned_name = (char *)malloc((strlen(name) + 1)*sizeof(char));
+    if (interned_name == NULL) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+    strcpy(interned_name, name);
+
+    // Assign selector
+    int selector = sel_handler->sel_count++;
+    sel_handler->names[selector] = interned_name;
+    sel_handler->hashes[selector] = hash;
+    *bucket = selector;
+    *dest = selector;
+    return NULL;
+}
+
+inst_error_t *selector_exists(prog_hand_t *prog_handler, bool *result, int *dest, char *name) {
+    if (result == NULL || name == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+    sel_hand_t *sel_handler = prog_handler->sel_handler;
+
+    // No names have been interned
+    if (sel_handler->bucket_count == 0) {
+        *result = false;
+        return NULL;
+    }
+
+    // Attempt to find the selector
+    int *bucket = __find_bucket(sel_handler, name, hash_name(name));
+    *result = *bucket != -1;
+    if (*result && dest != NULL) {
+        *dest = *bucket;
+    }
+    return NULL;
+}
+
+inst_error_t *get_selector_name(prog_hand_t *prog_handler, char **dest, int selector) {
+    if (dest == NULL || selector < 0 || selector >= prog_handler->sel_handler->sel_count) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    *dest = prog_handler->sel_handler->names[selector];
+    return NULL;
+}
+
+/*
+Finds the bucket containing the selector for the given name or the unused bucket where it would be
+placed. The Selector Handler must have at least one unused bucket
+
+*self: The Selector Handler to search
+*name: The name to find
+hash: The hash of the name
+
+Returns: The bucket for the name
+*/
+static int *__find_bucket(sel_hand_t *self, char *name, unsigned long hash) {
+    int mask = self->bucket_count - 1;
+    int index = hash & mask;
+    while (self->buckets[index] != -1) {
+        int selector = self->buckets[index];
+        // Only compare names when the hashes match
+        if (self->hashes[selector] == hash && !strcmp(name, self->names[selector])) {
+            break;
+        }
+        index = (index + 1) & mask;
+    }
+    return &(self->buckets[index]);
+}
+
+/*
+Resizes the hash table in the Selector Handler, moving all existing selectors into the new buckets
+
+*self: The Selector Handler to resize
+bucket_count: The new number of buckets - Must be a power of two
+
+Returns: Whether the buckets could be allocated. The existing buckets are kept on failure
+*/
+static bool __resize_buckets(sel_hand_t *self, int bucket_count) {
+    int *buckets = (int *)malloc(bucket_count*sizeof(int));
+    if (buckets == NULL) return false;
+    for (int i = 0; i < bucket_count; i++) {
+        buckets[i] = -1;
+    }
+
+    // Move selectors into new buckets
+    for (int selector = 0; selector < self->sel_count; selector++) {
+        int index = self->hashes[selector] & (bucket_count - 1);
+        while (buckets[index] != -1) {
+            index = (index + 1) & (bucket_count - 1);
+        }
+        buckets[index] = selector;
+    }
+    free(self->buckets);
+    self->buckets = buckets;
+    self->bucket_count = bucket_count;
+    return true;
+}
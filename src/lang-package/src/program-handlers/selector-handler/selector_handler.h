@@ -0,0 +1,74 @@
+/*
+Selector Handler
+By Ciaran Gruber
+
+The Selector Handler is used to intern the names of functions into integer selectors so that
+functions can be found without comparing their names. The names of member fields are also interned
+as they are shared by every instance of their class
+
+File-specific:
+Selector Handler - Header File
+The structures used to handle selectors within a program
+*/
+
+#ifndef SELECTOR_HANDLER
+#define SELECTOR_HANDLER
+
+#include "../../typedefs.h"
+
+/*
+Frees the memory occupied by a Selector Handler structure including the interned names
+
+*src: The Selector Handler structure whose memory is to be freed
+*/
+void free_sel_hand(sel_hand_t *src);
+
+/*
+Initialises the Selector Handler structure by resetting its values
+
+*src: The Selector Handler to initialise
+*/
+void init_sel_hand(sel_hand_t *src);
+
+/*
+Gets the selector for a function name, interning the name if it has not been used before. The
+selector does not change for the lifetime of the Selector Handler
+
+*prog_handler: The program handler that contains the class and error handlers
+*dest: The location to store the selector
+*name: The name of the function
+
+Errors:
+    ErrInvalidParameters: Thrown if 'dest' or 'name' is set to NULL
+    ErrOutOfMemory: Thrown if there is not enough memory to intern the name
+*/
+inst_error_t *get_selector(prog_hand_t *prog_handler, int *dest, char *name);
+
+/*
+Checks whether a function name has been interned and if it has, stores its selector in the 'dest'
+variable if it is specified
+
+*prog_handler: The program handler that contains the class and error handlers
+*result: A pointer to the boolean where the result is stored
+*dest: The location to store the selector
+*name: The name of the function
+
+Errors:
+    ErrInvalidParameters: Thrown if 'result' or 'name' is set to NULL
+*/
+inst_error_t *selector_exists(prog_hand_t *prog_handler, bool *result, int *dest, char *name);
+
+/*
+Gets the interned name for a selector. The name is owned by the Selector Handler and must not be
+modified or freed
+
+*prog_handler: The program handler that contains the class and error handlers
+**dest: The location to store the name
+selector: The selector of the name
+
+Errors:
+    ErrInvalidParameters: Thrown if 'dest' is set to NULL or the selector has not been assigned
+*/
+inst_error_t *get_selector_name(prog_hand_t *prog_handler, char **dest, int selector);
+
+#endif
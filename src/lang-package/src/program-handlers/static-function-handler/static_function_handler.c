@@ -13,6 +13,7 @@ The code used to provide for the implementation of a Static Function Handler
 #include "static_function_handler.h"
 #include "../error-handler/error_handler.h"
 #include "../../base-program/static-function/static_function_set.h"
+#include "../metadata-arena/meta_arena.h"
 
 static void __get_node(s_funct_hand_t *self, s_funct_hand_node_t **node, char *name);
 static void __get_next_node(s_funct_hand_t *self, s_funct_hand_node_t *prev, s_funct_hand_node_t **next,
@@ -23,14 +24,12 @@ static void __get_prev_node(s_funct_hand_t *self, bool *s_funct_exists, s_funct_
 void free_s_funct_hand(s_funct_hand_t *src) {
     if (src == NULL) return;
 
-    s_funct_hand_node_t *temp, *curr = src->first;
+    // The handler, its nodes and function sets are held in the Metadata Arena
+    s_funct_hand_node_t *curr = src->first;
     while (curr != NULL) {
         free_s_funct_set(curr->function_set);
-        temp = curr;
         curr = curr->next;
-        free(temp);
     }
-    free(src);
 }
 
 inst_error_t *new_sfhand(prog_hand_t *prog_handler, s_funct_hand_t *dest) {
@@ -38,6 +37,7 @@ inst_error_t *new_sfhand(prog_hand_t *prog_handler, s_funct_hand_t *dest) {
         return new_error(prog_handler, "ErrInvalidParameters");
     }
     dest->first = NULL;
+    return NULL;
 }
 
 inst_error_t *sfhand_add_function(prog_hand_t *prog_handler, s_funct_hand_t *self, s_function_t *function) {
@@ -58,7 +58,16 @@ inst_error_t *sfhand_add_function(prog_hand_t *prog_handler, s_funct_hand_t *sel
     }
 
     // Function set doesn't exist exist
-    s_funct_hand_node_t *new_node = (s_funct_hand_node_t *)malloc(sizeof(s_funct_hand_node_t));
+    s_funct_hand_node_t *new_node = (s_funct_hand_node_t *)arena_alloc(prog_handler,
+                                                                       sizeof(s_funct_hand_node_t));
+    if (new_node == NULL) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+    new_node->function_set = (s_function_set_t *)arena_alloc(prog_handler,
+                                                             sizeof(s_function_set_t));
+    if (new_node->function_set == NULL) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
     // Create function set
     error = new_s_funct_set(prog_handler, new_node->function_set, function->name);
     if (error != NULL) return error;
@@ -106,7 +115,6 @@ inst_error_t *sfhand_remove_function(prog_hand_t *prog_handler, s_funct_hand_t *
         } else {
             prev->next = curr->next;
         }
-        free(curr);
     }
     return NULL;
 }
@@ -118,15 +126,34 @@ inst_error_t *sfhand_get_function(prog_hand_t *prog_handler, s_funct_hand_t *sel
         return new_error(prog_handler, "ErrInvalidParameters");
     }
 
+    // Attempt to get function
+    bool found;
+    error = sfhand_try_get_function(prog_handler, self, &found, dest, name, param_types,
+                                    param_count);
+    if (error != NULL) return error;
+    if (!found) {
+        return new_error(prog_handler, "ErrFunctionNotDefined");
+    }
+    return NULL;
+}
+
+inst_error_t *sfhand_try_get_function(prog_hand_t *prog_handler, s_funct_hand_t *self,
+        bool *found, s_function_t **dest, char *name, class_t **param_types, int param_count) {
+    inst_error_t *error;
+    if (self == NULL || found == NULL || dest == NULL || name == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
     // Get the function node
     s_funct_hand_node_t *curr;
     __get_node(self, &curr, name);
-    // Throw error if node could not be found
     if (curr == NULL) {
-        return new_error(prog_handler, "ErrFunctionNotDefined");
+        *found = false;
+        return NULL;
     }
     // Get function from function set
-    error = sfset_get_function(prog_handler, curr->function_set, dest, param_types, param_count);
+    error = sfset_try_get_function(prog_handler, curr->function_set, found, dest, param_types,
+                                   param_count);
     return error;
 }
 
@@ -145,8 +172,9 @@ inst_error_t *sfhand_function_exists(prog_hand_t *prog_handler, bool *result, s_
         return NULL;
     }
     // Check function set
-    *result = sfset_function_exists(prog_handler, curr->function_set, result, param_types, param_count);
-    return NULL;
+    error = sfset_function_exists(prog_handler, curr->function_set, result, param_types,
+                                  param_count);
+    return error;
 }
 
 static void __get_prev_node(s_funct_hand_t *self, bool *fset_exists, s_funct_hand_node_t **prev_node,
@@ -15,7 +15,8 @@ The structures used to represent a Static Function Handler
 #include "../../typedefs.h"
 
 /*
-Frees the memory occupuied by a Static Function Handler structure
+Frees the Functions within a Static Function Handler structure. The handler, its nodes and its
+function sets are held in the Metadata Arena and are freed along with the program handler
 
 *src: The Static Function Handler structure whose memory is to be freed
 */
@@ -78,6 +79,24 @@ Errors:
 inst_error_t *sfhand_get_function(prog_hand_t *prog_handler, s_funct_hand_t *self, s_function_t **dest,
         char *name, class_t **param_types, int param_count);
 
+/*
+Gets a function from the handler based upon the name and parameters without throwing an error if the
+function could not be found
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The Static Function Handler to get the function from
+*found: A boolean value representing whether the function was found
+**dest: A pointer to the function which is only set if the function was found
+*name: The name of the function
+**param_types: The parameters used within the function
+param_count: The number of parameters used by the function
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self', 'found', 'dest' or 'name' is set to NULL
+*/
+inst_error_t *sfhand_try_get_function(prog_hand_t *prog_handler, s_funct_hand_t *self,
+        bool *found, s_function_t **dest, char *name, class_t **param_types, int param_count);
+
 /*
 Returns whether the function exists in the Static Function Handler and if it does, returns a
 reference to the node before that function
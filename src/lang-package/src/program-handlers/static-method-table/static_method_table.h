@@ -0,0 +1,138 @@
+/*
+Static Method Table
+By Ciaran Gruber
+
+The Static Method Table is a flattened table of every Static Function that can be run by a class,
+including those inherited from parent classes, so that a function can be found without searching
+each parent class
+
+File-specific:
+Static Method Table - Header File
+The structures used to represent a Static Method Table
+*/
+
+#ifndef STATIC_METHOD_TABLE
+#define STATIC_METHOD_TABLE
+
+#include "../../typedefs.h"
+
+typedef struct s_mtable_entry s_mtable_entry_t;
+
+/* An entry in the Static Method Table that contains every Static Function with the same selector */
+struct s_mtable_entry {
+    int selector;             // The selector of the Static Functions in the entry - -1 if unused
+    s_function_t **functions; // The Static Functions with the selector, overriding functions first
+    int function_count;       // The number of Static Functions in the entry
+    int function_capacity;    // The number of Static Functions that can be stored before resizing
+};
+
+/* A structure that holds the Static Functions available to a class */
+struct gen_s_method_table {
+    s_mtable_entry_t *entries; // The entries in the table
+    int entry_count;           // The number of used entries in the table
+    int capacity;              // The number of entries in the table - Always a power of two
+};
+
+/*
+Frees the memory occupied by a Static Method Table structure. The Static Functions within the table
+are owned by the Static Function Handlers of each class and are not freed
+
+*src: The Static Method Table structure whose memory is to be freed
+*/
+void free_smtable(s_method_table_t *src);
+
+/*
+Creates a new Static Method Table by resetting the source variable
+
+*prog_handler: The program handler that contains the class and error handlers
+*dest: The pointer to the Static Method Table to initialise
+
+Errors:
+    ErrInvalidParameters: Thrown if 'dest' is set to NULL
+*/
+inst_error_t *new_smtable(prog_hand_t *prog_handler, s_method_table_t *dest);
+
+/*
+Copies every Static Function from one Static Method Table into another, typically used to inherit
+the Static Functions from a parent class
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The Static Method Table to copy the Static Functions into
+*src: The Static Method Table to copy the Static Functions from
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self' or 'src' is set to NULL
+    ErrOutOfMemory: Thrown if there is not enough memory to copy the Static Functions
+*/
+inst_error_t *smtable_inherit(prog_hand_t *prog_handler, s_method_table_t *self,
+        s_method_table_t *src);
+
+/*
+Adds a Static Function to the Static Method Table, replacing any Static Function that has the same
+name and parameter types so that the given Static Function overrides it
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The Static Method Table to add the Static Function to
+*function: The Static Function to add to the Static Method Table
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self' or 'function' is set to NULL
+    ErrOutOfMemory: Thrown if there is not enough memory to add the Static Function
+*/
+inst_error_t *smtable_add_function(prog_hand_t *prog_handler, s_method_table_t *self,
+        s_function_t *function);
+
+/*
+Gets a Static Function from the Static Method Table based upon the name and parameters
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The Static Method Table to get the Static Function from
+**dest: A pointer to the Static Function
+*name: The name of the Static Function
+**param_types: The parameters used within the Static Function
+param_count: The number of parameters used by the Static Function
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self', 'dest' or 'name' is set to NULL
+    ErrFunctionNotDefined: Thrown if the Static Function could not be found
+*/
+inst_error_t *smtable_get_function(prog_hand_t *prog_handler, s_method_table_t *self,
+        s_function_t **dest, char *name, class_t **param_types, int param_count);
+
+/*
+Gets a Static Function from the Static Method Table based upon the selector of its name and
+parameters
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The Static Method Table to get the Static Function from
+**dest: A pointer to the Static Function
+selector: The selector of the name of the Static Function
+**param_types: The parameters used within the Static Function
+param_count: The number of parameters used by the Static Function
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self' or 'dest' is set to NULL
+    ErrFunctionNotDefined: Thrown if the Static Function could not be found
+*/
+inst_error_t *smtable_get_function_sel(prog_hand_t *prog_handler, s_method_table_t *self,
+        s_function_t **dest, int selector, class_t **param_types, int param_count);
+
+/*
+Gets a Static Function from the Static Method Table based upon the selector of its name and
+parameters without throwing an error if the Static Function could not be found
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The Static Method Table to get the Static Function from
+*found: A boolean value representing whether the Static Function was found
+**dest: A pointer to the Static Function which is only set if the Static Function was found
+selector: The selector of the name of the Static Function
+**param_types: The parameters used within the Static Function
+param_count: The number of parameters used by the Static Function
+
+Errors:
+    ErrInvalidParameters: Thrown if 'self', 'found' or 'dest' is set to NULL
+*/
+inst_error_t *smtable_try_get_function_sel(prog_hand_t *prog_handler, s_method_table_t *self,
+        bool *found, s_function_t **dest, int selector, class_t **param_types, int param_count);
+
+#endif
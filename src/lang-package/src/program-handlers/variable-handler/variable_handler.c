@@ -14,6 +14,7 @@ The code used to provide for the implementation of a Variable Handler
 #include "../../base-program/variable/variable.h"
 #include "../../base-program/variable/var_description.h"
 #include "../../program-handlers/error-handler/error_handler.h"
+#include "../../program-handlers/collector/collector.h"
 
 void free_var_hand(var_hand_t *src) {
     if (src == NULL) return;
@@ -21,7 +22,7 @@ void free_var_hand(var_hand_t *src) {
     var_hand_node_t *next, *curr = src->first;
     while (curr != NULL) {
         next = curr->next;
-        free_var(curr->variable);
+        release_var_atomic(curr->variable);
         free(curr);
         curr = next;
     }
@@ -42,6 +43,11 @@ inst_error_t *add_var(prog_hand_t *prog_handler, var_hand_t *self, var_t *variab
     if (self == NULL || variable == NULL) {
         return new_error(prog_handler, "ErrInvalidParameters");
     }
+    // Variables tracked by the collector are freed by it so the handler can not hold a reference,
+    // and immediates have no description to hold a name
+    if ((variable->gc_flags & GC_TRACKED) || variable->desc == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
 
     // Return an error if a variable is found
     var_hand_node_t *prev = NULL;
@@ -59,6 +65,9 @@ inst_error_t *add_var(prog_hand_t *prog_handler, var_hand_t *self, var_t *variab
 
     // Add variable
     var_hand_node_t *new_node = (var_hand_node_t *)malloc(sizeof(var_hand_node_t));
+    if (new_node == NULL) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
     new_node->variable = variable;
     if (prev != NULL) {
         prev->next = new_node;
@@ -71,6 +80,9 @@ inst_error_t *add_var(prog_hand_t *prog_handler, var_hand_t *self, var_t *variab
 
 inst_error_t *remove_var(prog_hand_t *prog_handler, var_hand_t *self, var_t *variable) {
     inst_error_t *error;
+    if (variable == NULL || variable->desc == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
     error = remove_var_by_name(prog_handler, self, variable->desc->name);
     return error;
 }
@@ -105,7 +117,7 @@ inst_error_t *remove_var_by_name(prog_hand_t *prog_handler, var_hand_t *self, ch
     } else {
         self->first = curr->next;
     }
-    free_var(curr->variable);
+    release_var_atomic(curr->variable);
     free(curr);
     return NULL;
 }
@@ -116,17 +128,35 @@ inst_error_t *get_var(prog_hand_t *prog_handler, var_hand_t *self, var_t **dest,
         return new_error(prog_handler, "ErrInvalidParameters");
     }
 
+    // Attempt to get variable
+    bool found;
+    error = try_get_var(prog_handler, self, &found, dest, name);
+    if (error != NULL) return error;
+    if (!found) {
+        return new_error(prog_handler, "ErrVariableNotDefined");
+    }
+    return NULL;
+}
+
+inst_error_t *try_get_var(prog_hand_t *prog_handler, var_hand_t *self, bool *found, var_t **dest,
+        char *name) {
+    if (self == NULL || found == NULL || dest == NULL || name == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
     // Attempt to find and point to the variable
     var_hand_node_t *curr = self->first;
     while (curr != NULL) {
         int comparison = strcmp(name, curr->variable->desc->name);
         if (!comparison) {
             *dest = curr->variable;
+            *found = true;
             return NULL;
         } else if (comparison < 0) {
             break;
         }
         curr = curr->next;
     }
-    return new_error(prog_handler, "ErrVariableNotDefined");
+    *found = false;
+    return NULL;
 }
\ No newline at end of file
@@ -15,7 +15,8 @@ The structures used to handle the Variables within an instance and class
 #include "../../typedefs.h"
 
 /*
-Frees the memory occupuied by a Variable Handler structure
+Frees the memory occupuied by a Variable Handler structure, releasing the reference it holds to each
+Variable
 
 *src: The Variable Handler structure whose memory is to be freed
 */
@@ -33,14 +34,17 @@ Errors:
 inst_error_t *var_hand_create(prog_hand_t *prog_handler, var_hand_t *src);
 
 /*
-Adds a variable to the Variable Handler
+Adds a variable to the Variable Handler, which takes over the reference given to it. The variable
+must be retained first if it is still used elsewhere. References are released atomically so the
+variable may be shared between threads
 
 *prog_handler: The program handler that contains the class and error handlers
 *self: The Variable Handler that is to be modified
 *variable: The variable to add to the Variable Handler
 
 Errors:
-    ErrInvalidParameters: Thrown if the Variable Handler or variable is set to NULL
+    ErrInvalidParameters: Thrown if the Variable Handler or variable is set to NULL or the variable is
+                          an immediate or tracked by the collector
     ErrOutOfMemory: Thrown if there is not enough memory to add a Variable if required
     ErrVariableNameTaken: Thrown if a variable with the same name already exists in the Variable
                           Handler
@@ -48,20 +52,22 @@ Errors:
 inst_error_t *add_var(prog_hand_t *prog_handler, var_hand_t *self, var_t *variable);
 
 /*
-Removes a Variable from the Variable Handler
+Removes a Variable from the Variable Handler, releasing the reference held by the handler
 
 *prog_handler: The program handler that contains the class and error handlers
 *self: The Variable Handler to remove the Variable from
 *variable: The variable to remove from the Variable Handler
 
 Errors:
-    ErrInvalidParameters: Thrown if '*self' or '*variable' is set to NULL
+    ErrInvalidParameters: Thrown if '*self' or '*variable' is set to NULL or the variable is an
+                          immediate
     ErrVariableNotDefined: Thrown if the given variable can not be found within the Variable Handler
 */
 inst_error_t *remove_var(prog_hand_t *prog_handler, var_hand_t *self, var_t *variable);
 
 /*
-Removes a Variable from the Variable Handler by its name and parameters
+Removes a Variable from the Variable Handler by its name and parameters, releasing the reference
+held by the handler
 
 *prog_handler: The program handler that contains the class and error handlers
 *self: The Variable Handler to remove the Variable from
@@ -89,4 +95,19 @@ Errors:
 */
 inst_error_t *get_var(prog_hand_t *prog_handler, var_hand_t *self, var_t **dest, char *name);
 
+/*
+Gets a Variable from the Variable Handler without throwing an error if the Variable can not be found
+
+*prog_handler: The program handler that contains the class and error handlers
+*self: The Variable Handler to get the Variable from
+*found: A boolean value representing whether the Variable was found
+**dest: A pointer to the Variable which is only set if the Variable was found
+*name: The name of the variable to get
+
+Errors:
+    ErrInvalidParameters: Thrown if any of the values are set to NULL
+*/
+inst_error_t *try_get_var(prog_hand_t *prog_handler, var_hand_t *self, bool *found, var_t **dest,
+        char *name);
+
 #endif
\ No newline at end of file
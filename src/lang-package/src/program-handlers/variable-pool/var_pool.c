@@ -0,0 +1,145 @@
+/*
+Variable Pool
+By Ciaran Gruber
+
+The Variable Pool is a program-wide slab allocator used for the small blocks of memory that make up
+variables such as their descriptions, names and member fields. Blocks are split into size classes
+and freed blocks are kept in a free list for each size class so that they can be reused without
+calling malloc
+
+File-specific:
+Variable Pool - Code File
+The code used to provide for the implementation of a Variable Pool
+*/
+
+#include "var_pool.h"
+#include "../error-handler/error_handler.h"
+#include "../program-handler/program_handler.h"
+#include "../region/region.h"
+
+static bool __add_slab(pool_size_class_t *size_class);
+
+void free_var_pool(var_pool_t *src) {
+    if (src == NULL) return;
+
+    for (int i = 0; i < POOL_CLASS_COUNT; i++) {
+        pool_slab_t *curr = src->size_classes[i].slabs;
+        while (curr != NULL) {
+            pool_slab_t *next = curr->next;
+            free(curr);
+            curr = next;
+        }
+    }
+    free(src);
+}
+
+void init_var_pool(var_pool_t *src) {
+    size_t block_size = POOL_MIN_BLOCK_SIZE;
+    for (int i = 0; i <= POOL_CLASS_COUNT; i++) {
+        pool_size_class_t *size_class = &(src->size_classes[i]);
+        // The last size class is for large blocks so it has no block size
+        size_class->block_size = i < POOL_CLASS_COUNT ? block_size : 0;
+        size_class->free_list = NULL;
+        size_class->slabs = NULL;
+        size_class->slab_count = 0;
+        size_class->live_count = 0;
+        size_class->free_count = 0;
+        block_size *= 2;
+    }
+}
+
+void *pool_alloc(prog_hand_t *prog_handler, size_t size) {
+    var_pool_t *pool = prog_handler->var_pool;
+    size_t needed = sizeof(pool_block_t) + size;
+
+    // Blocks allocated within a region have no size class and are discarded when the region ends
+    if (in_region(prog_handler)) {
+        pool_block_t *block = (pool_block_t *)region_alloc(prog_handler, needed);
+        if (block == NULL) return NULL;
+        block->size_class = NULL;
+        return (void *)(block + 1);
+    }
+
+    // Find the smallest size class the block fits in
+    int index = 0;
+    while (index < POOL_CLASS_COUNT && pool->size_classes[index].block_size < needed) {
+        index++;
+    }
+    pool_size_class_t *size_class = &(pool->size_classes[index]);
+
+    pool_block_t *block;
+    if (index == POOL_CLASS_COUNT) {
+        block = (pool_block_t *)malloc(needed);
+        if (block == NULL) return NULL;
+    } else {
+        if (size_class->free_list == NULL && !__add_slab(size_class)) return NULL;
+        // Each free block stores the next free block in the data after its header
+        block = (pool_block_t *)size_class->free_list;
+        size_class->free_list = *(void **)(block + 1);
+        size_class->free_count--;
+    }
+    block->size_class = size_class;
+    size_class->live_count++;
+    return (void *)(block + 1);
+}
+
+void pool_free(void *src) {
+    if (src == NULL) return;
+
+    pool_block_t *block = (pool_block_t *)src - 1;
+    pool_size_class_t *size_class = block->size_class;
+    if (size_class == NULL) return;
+    size_class->live_count--;
+    if (size_class->block_size == 0) {
+        free(block);
+        return;
+    }
+    *(void **)src = size_class->free_list;
+    size_class->free_list = block;
+    size_class->free_count++;
+}
+
+inst_error_t *get_pool_stats(prog_hand_t *prog_handler, long *live_blocks, long *free_blocks,
+        size_t *slab_bytes) {
+    if (live_blocks == NULL || free_blocks == NULL || slab_bytes == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+
+    var_pool_t *pool = prog_handler->var_pool;
+    *live_blocks = 0;
+    *free_blocks = 0;
+    *slab_bytes = 0;
+    for (int i = 0; i <= POOL_CLASS_COUNT; i++) {
+        *live_blocks += pool->size_classes[i].live_count;
+        *free_blocks += pool->size_classes[i].free_count;
+        *slab_bytes += pool->size_classes[i].slab_count*POOL_SLAB_SIZE;
+    }
+    return NULL;
+}
+
+/*
+Allocates a new slab for a size class and adds each of its blocks to the free list
+
+*size_class: The size class to add the slab to
+
+Returns: Whether the slab could be allocated
+*/
+static bool __add_slab(pool_size_class_t *size_class) {
+    pool_slab_t *slab = (pool_slab_t *)malloc(POOL_SLAB_SIZE);
+    if (slab == NULL) return false;
+    slab->next = size_class->slabs;
+    size_class->slabs = slab;
+    size_class->slab_count++;
+
+    // Add the blocks in reverse so that they are handed out in address order
+    size_t block_count = (POOL_SLAB_SIZE - sizeof(pool_slab_t)) / size_class->block_size;
+    char *blocks = (char *)(slab + 1);
+    for (size_t i = block_count; i > 0; i--) {
+        pool_block_t *block = (pool_block_t *)(blocks + (i - 1)*size_class->block_size);
+        block->size_class = size_class;
+        *(void **)(block + 1) = size_class->free_list;
+        size_class->free_list = block;
+    }
+    size_class->free_count += block_count;
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+/*
+Variable Pool
+By Ciaran Gruber
+
+The Variable Pool is a program-wide slab allocator used for the small blocks of memory that make up
+variables such as their descriptions, names and member fields. Blocks are split into size classes
+and freed blocks are kept in a free list for each size class so that they can be reused without
+calling malloc
+
+File-specific:
+Variable Pool - Header File
+The structures used to represent a Variable Pool
+*/
+
+#ifndef VAR_POOL
+#define VAR_POOL
+
+#include <stddef.h>
+#include "../../typedefs.h"
+
+/* The number of size classes in the Variable Pool, not including the size class for large blocks */
+#define POOL_CLASS_COUNT 5
+/* The size of the smallest size class including the header of each block */
+#define POOL_MIN_BLOCK_SIZE 32
+/* The size of each slab that blocks are split from */
+#define POOL_SLAB_SIZE 16384
+
+typedef struct pool_size_class pool_size_class_t;
+typedef struct pool_block pool_block_t;
+typedef struct pool_slab pool_slab_t;
+
+/* The header stored before every block so that it can be freed without the program handler */
+struct pool_block {
+    pool_size_class_t *size_class; // The size class the block was allocated from - NULL in a region
+};
+
+/* A slab of memory that is split into the blocks of a single size class */
+struct pool_slab {
+    pool_slab_t *next; // The next slab of the same size class
+};
+
+/* A size class containing the slabs and free blocks of a single block size */
+struct pool_size_class {
+    size_t block_size;  // The size of each block including its header - 0 for large blocks
+    void *free_list;    // The first free block, each free block stores the next in its data
+    pool_slab_t *slabs; // The slabs the blocks are split from
+    long slab_count;    // The number of slabs allocated for the size class
+    long live_count;    // The number of blocks that are in use
+    long free_count;    // The number of blocks in the free list
+};
+
+/* A structure that holds the size classes of a Variable Pool */
+struct gen_var_pool {
+    /*
+    The size classes of the pool, each double the size of the one before it. The last size class
+    is used for blocks that are too large for the others which are allocated with malloc
+    */
+    pool_size_class_t size_classes[POOL_CLASS_COUNT + 1];
+};
+
+/*
+Frees the memory occupied by a Variable Pool structure including every slab. Any block that is still
+in use must not be used or freed afterwards
+
+*src: The Variable Pool structure whose memory is to be freed
+*/
+void free_var_pool(var_pool_t *src);
+
+/*
+Initialises the Variable Pool structure without allocating any slabs
+
+*src: The Variable Pool to initialise
+*/
+void init_var_pool(var_pool_t *src);
+
+/*
+Allocates a block of memory from the Variable Pool, reusing a freed block of the same size class if
+there is one. Blocks too large for every size class are allocated with malloc and blocks allocated
+while a region has begun are allocated within the region instead
+
+*prog_handler: The program handler that contains the Variable Pool
+size: The number of bytes needed
+
+Returns: The allocated block or NULL if there is not enough memory
+*/
+void *pool_alloc(prog_hand_t *prog_handler, size_t size);
+
+/*
+Returns a block allocated by pool_alloc to the free list of its size class. Blocks allocated within
+a region are left until the region ends
+
+*src: The block to free, set to NULL to do nothing
+*/
+void pool_free(void *src);
+
+/*
+Gets the statistics of the Variable Pool across every size class
+
+*prog_handler: The program handler that contains the Variable Pool
+*live_blocks: A pointer to where the number of blocks in use will be stored
+*free_blocks: A pointer to where the number of freed blocks waiting to be reused will be stored
+*slab_bytes: A pointer to where the number of bytes allocated for slabs will be stored
+
+Errors:
+    ErrInvalidParameters: Thrown if 'live_blocks', 'free_blocks' or 'slab_bytes' is set to NULL
+*/
+inst_error_t *get_pool_stats(prog_hand_t *prog_handler, long *live_blocks, long *free_blocks,
+        size_t *slab_bytes);
+
+#endif
\ No newline at end of file
@@ -11,12 +11,21 @@ Typedef File - Header File
 
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdatomic.h>
+
+/*
+The tags of immediates, which are variables of primitive classes that have no description. The class
+of an immediate is found from its tag so that it can be used without allocating any memory
+*/
+#define IMM_NONE 0      // The variable is not an immediate and has a description
+#define IMM_INTEGER 1   // The variable is an immediate Integer
+#define IMM_BOOLEAN 2   // The variable is an immediate Boolean
+#define IMM_CHAR 3      // The variable is an immediate Char
+#define IMM_TAG_COUNT 4 // The number of tags including IMM_NONE
 
 /* A node in the Variable Description Handler that contains a Variable Description and a link to
 the next node */
 typedef struct var_desc_hand_node var_desc_hand_node_t;
-/* A node in the Error Handler that contains an allowed error and a link to the next node */
-typedef struct err_hand_node err_hand_node_t;
 /* A node in the Class Handler that contains a class and a link to the next node */
 typedef struct class_node class_node_t;
 /* A node in the Function Handler that contains a function set and a link to the next node */
@@ -52,8 +61,32 @@ typedef struct gen_class_hand cls_hand_t;
 typedef struct gen_err_hand err_hand_t;
 /* A structure that holds the Variables contained in a Variable Handler */
 typedef struct gen_var_hand var_hand_t;
+/* A structure that holds the member fields of an instance with managed data */
+typedef struct gen_inst_fields inst_fields_t;
+/* A structure that holds instances of a single class constructed together */
+typedef struct gen_var_array var_array_t;
 /* A structure that holds the Variable Descriptions contained in a Variable Description Handler */
 typedef struct gen_var_desc_hand var_desc_hand_t;
+/* A structure that holds the interned function names contained in a Selector Handler */
+typedef struct gen_sel_hand sel_hand_t;
+/* A structure that holds the Functions available to instances of a class including inherited ones */
+typedef struct gen_method_table method_table_t;
+/* A structure that caches the Function resolved at a single place where a function is run */
+typedef struct gen_call_site call_site_t;
+/* A structure that holds the slot of a member field resolved once for a class and field name */
+typedef struct gen_field_handle field_handle_t;
+/* A structure that caches the Functions found for each class, selector and set of parameters */
+typedef struct gen_method_cache method_cache_t;
+/* A structure that holds the slabs of memory that variables are allocated from */
+typedef struct gen_var_pool var_pool_t;
+/* A structure that holds the chunks of memory that the metadata of classes is allocated from */
+typedef struct gen_meta_arena meta_arena_t;
+/* A structure that holds the scratch memory of the regions that have begun and not yet ended */
+typedef struct gen_region region_t;
+/* A structure that holds the Static Functions available to a class including inherited ones */
+typedef struct gen_s_method_table s_method_table_t;
+/* A structure that holds the variables tracked by the tracing collector and their roots */
+typedef struct gen_collector collector_t;
 
 /* A type of variable used to represent an Error instance */
 typedef var_t inst_error_t;
@@ -67,23 +100,27 @@ typedef class_t cls_object_t;
 /* A node in the Class Handler that contains a class and a link to the next node */
 struct class_node {
     class_t *class;     // The class contained within the node
-    class_node_t *next; // The next node in the Class Handler
+    class_node_t *next; // The next node in the same bucket of the Class Handler
 };
 
 /* A structure that holds the classes contained in a Class Handler */
 struct gen_class_hand {
-    class_node_t *first; // The first class node in the Class Handler
-};
-
-/* A node in the Error Handler that contains an allowed error and a link to the next node */
-struct err_hand_node {
-    cls_error_t *allowed_error; // The error that is allowed as part of the Error Handler
-    err_hand_node_t *next;      // A pointer to the next node in the Error Handler
+    class_node_t **buckets; // The hash table buckets used to find a class by its name
+    int bucket_count;       // The number of buckets in the hash table - Always a power of two
+    class_t **classes;      // The classes in the Class Handler indexed by their class ID
+    int class_count;        // The number of classes in the Class Handler
+    int class_capacity;     // The number of classes that can be stored before resizing
+    bool is_numbered;       // Whether every class has been given its position in the class tree
 };
 
 /* A structure that holds the allowed errors contained in a Error Handler */
 struct gen_err_hand {
-    err_hand_node_t *first; // A pointer to the first node in the Error Handler
+    /*
+    The number of times each error class has been added to the Error Handler, indexed by the class
+    ID assigned by the Class Handler. An error is caught if its count is greater than zero
+    */
+    int *catch_counts;
+    int catch_capacity; // The number of class IDs that can be counted before resizing
 };
 
 /* A node in the Function Handler that contains a function set and a link to the next node */
@@ -131,9 +168,28 @@ struct gen_var_desc_hand {
     var_desc_hand_node_t *first; // The first node in the Variable Handler
 };
 
+/* A structure that holds the interned function names contained in a Selector Handler */
+struct gen_sel_hand {
+    char **names;           // The interned names indexed by their selector
+    unsigned long *hashes;  // The hash of each interned name indexed by their selector
+    int *buckets;           // The selectors in the hash table - Unused buckets are set to -1
+    int bucket_count;       // The number of buckets in the hash table - Always a power of two
+    int sel_count;          // The number of interned names
+    int sel_capacity;       // The number of names that can be stored before resizing
+};
+
 /* A structure that holds the various features contained in a Class */
 struct gen_class {
     char *class_name;             // A string representing the type
+    unsigned long name_hash;      // The hash of the class name used by the Class Handler
+    int class_id;                 // The stable ID assigned to the class by the Class Handler
+    /*
+    The position of the class in a pre-order walk of the class tree. Every subclass of the class
+    has a position from 'pre_order' up to but not including 'subtree_end' which allows a subclass to
+    be checked in constant time. These are assigned by the Class Handler when it is numbered
+    */
+    int pre_order;
+    int subtree_end;
     /*
     A boolean value representing whether an instance of the class has instance variables or
     unstructured data
@@ -147,11 +203,44 @@ struct gen_class {
     */
     bool has_managed_data;
     size_t size;                    // An integer representing the size of the variable
+    int imm_tag;                    // The tag given to immediates of the class - IMM_NONE if none
     class_t *parent;                // The parent Class which this class inherits from
     s_funct_hand_t *static_methods; // The function handler for the class
     funct_hand_t *inst_methods;     // The method handler for instances of the class
     var_hand_t *class_vars;         // The variables shared by all members of the class
     var_desc_hand_t *mem_fields;    // The member fields in instances of this class
+    /*
+    The slot of each member field in instances of the class, with inherited member fields first so
+    that a member field keeps the same slot in every subclass. This is built when the class is linked
+    */
+    var_desc_t **field_layout;
+    int field_count;                // The number of member fields in the field layout
+    /*
+    The member fields of a default constructed instance, which are copied into each new instance
+    instead of constructing every member field again. This is built the first time an instance is
+    created after the class is linked
+    */
+    inst_fields_t *prototype;
+    function_t *constructor;        // The constructor run without parameters - NULL if none
+    /*
+    The hook run by the collector to mark the variables referred to by the unmanaged data of an
+    instance of the class. This is NULL if the unmanaged data does not refer to any variables
+    */
+    inst_error_t *(*trace)(prog_hand_t *, var_t *);
+    /*
+    The flattened tables of every function available to the class including inherited functions.
+    These are built when the class is linked and are rebuilt whenever 'is_linked' is false
+    */
+    method_table_t *inst_table;     // The table of own and inherited Non-Static Functions
+    s_method_table_t *static_table; // The table of own and inherited Static Functions
+    bool is_linked;                 // Whether the method tables are up to date with the class
+    unsigned int link_count;        // The number of times the method tables have been built
+    /*
+    The immutable instance returned whenever an error of the class is thrown. It is preallocated
+    when an Error class is created so that throwing and catching an error does not allocate memory
+    and is NULL for classes that are not Error classes
+    */
+    inst_error_t *error_inst;
 };
 
 /* A structure that holds the various features contained in a Variable */
@@ -159,18 +248,60 @@ struct gen_var {
     var_desc_t *desc; // The description of the variable with key features within the variable
     void *data;       // The data in bytes used to represent the variable
     bool initialised; // Whether the data has been initialised or not
+    bool pooled;      // Whether the variable itself was allocated from the Variable Pool
+    bool embedded;    // Whether the variable is stored within memory owned by another structure
+    bool inline_data; // Whether unmanaged data is stored in the bytes of 'data' instead of memory
+    /* The flags used by the collector, which are 0 if the variable is not tracked by it */
+    unsigned char gc_flags;
+    int imm_tag;      // The tag of the class of an immediate - IMM_NONE if 'desc' is set
+    /*
+    The number of references to the variable, which is freed when the last reference is released.
+    Embedded variables, such as member fields, are not counted and are freed with their holder
+    */
+    atomic_int ref_count;
+};
+
+/*
+The data of an instance with managed data. Every member field is stored in one block in the slot
+given to it by the field layout of the class when the instance was created
+*/
+struct gen_inst_fields {
+    int field_count; // The number of member fields stored in the block
+    var_t fields[];  // The member fields indexed by their slot
+};
+
+/*
+Instances of a single class constructed together by new_var_array. The instances and the member field
+blocks of instances with managed data are stored in the same allocation directly after the array
+*/
+struct gen_var_array {
+    int count;        // The number of instances that have been constructed
+    var_desc_t *desc; // The description shared by every instance when it was constructed
+    var_t *vars;      // The instances, stored contiguously
 };
 
 /* A structure that holds the various features contained in a Variable */
+/*
+The description of a variable. Descriptions may be shared, such as the description of a member field
+which is used by the class, its field layout and each instance, so a shared description must not be
+changed and is only freed once every reference to it has been released
+*/
 struct gen_var_desc {
     class_t *type;    // A reference to the type used to represent a variable
     char *name;       // The name that is unique to the variable within its scope
+    bool owns_name;   // Whether the name was copied for the description and is freed with it
     bool initialised; // A boolean representing whether the variable has been initialised yet
+    /*
+    The number of references to the description. This is changed atomically as instances sharing
+    the description may be released by different threads
+    */
+    atomic_int ref_count;
 };
 
 /* A structure that holds the various features contained in a Function */
 struct gen_function {
     char *name;            // The name of the Function
+    int selector;          // The selector of the interned name of the Function
     /* 
     A pointer to the related function that is run
 
@@ -189,6 +320,7 @@ struct gen_function {
 /* A structure that holds the various features contained in a Static Function */
 struct gen_s_function {
     char *name;            // The name of the Static Function
+    int selector;          // The selector of the interned name of the Static Function
     /* 
     A pointer to the related function that is run
 
@@ -203,4 +335,31 @@ struct gen_s_function {
     int param_count;       // The number of parameters in the Static Function
 };
 
+/* A structure that caches the Function resolved at a single place where a function is run */
+struct gen_call_site {
+    int selector;    // The selector of the name of the function that is run
+    int param_count; // The number of parameters passed to the function
+    /*
+    The cached Function and the classes it was resolved for. The cached Function is only used
+    when the receiver and parameters have exactly the same classes and the receiver class has not
+    been linked again since the Function was resolved
+    */
+    class_t *cached_class;       // The class of the receiver when the Function was resolved
+    unsigned int cached_link;    // The link count of the receiver class when it was resolved
+    class_t **cached_params;     // The classes of the parameters when the Function was resolved
+    function_t *cached_function; // The Function that was resolved - NULL if nothing is cached
+};
+
+/* A structure that holds the slot of a member field resolved once for a class and field name */
+struct gen_field_handle {
+    class_t *class;   // The class the handle was resolved for
+    int slot;         // The slot of the member field in the field layout of the class
+    /*
+    The description of the member field. Instances of the class and its subclasses share this
+    description in the slot, so comparing it checks that the instance has the member field without
+    comparing names
+    */
+    var_desc_t *desc;
+};
+
 #endif
\ No newline at end of file
@@ -0,0 +1,213 @@
+/*
+Boolean Type
+By Ciaran Gruber
+
+The Boolean Class is one of the base variable types that hold data in its own data holding. Booleans
+are small enough to be used as immediates so they do not need a description or any memory
+
+Parent Class: Object
+
+File-specific:
+Boolean Type - Code File
+The code used to provide for the implementation of a Boolean type
+*/
+
+#include "t_Boolean.h"
+#include "../type_creator.h"
+#include "../Object/t_Object.h"
+#include "../../program-handlers/error-handler/error_handler.h"
+#include "../../program-handlers/class-handler/class_handler.h"
+#include "../../base-program/variable/variable.h"
+#include "../../base-program/function/function.h"
+
+// Initialisation Functions - Used to initialise the class
+
+static inst_error_t *add_constructor(prog_hand_t *prog_handler, cls_boolean_t *bool_class);
+static inst_error_t *add_operator(prog_hand_t *prog_handler, cls_boolean_t *bool_class,
+        char *name, inst_error_t *(*operator)(prog_hand_t *, var_t *, var_t *, var_t **),
+        int param_count);
+
+// Non-Static Functions
+
+static inst_error_t *constructor(prog_hand_t *prog_handler, inst_boolean_t *self,
+        var_t *void_return, var_t **void_params);
+static inst_error_t *logical_and(prog_hand_t *prog_handler, inst_boolean_t *self,
+        var_t *void_return, inst_boolean_t **params);
+static inst_error_t *logical_or(prog_hand_t *prog_handler, inst_boolean_t *self,
+        var_t *void_return, inst_boolean_t **params);
+static inst_error_t *logical_not(prog_hand_t *prog_handler, inst_boolean_t *self,
+        var_t *void_return, var_t **void_params);
+
+inst_error_t *new_boolean_cls(prog_hand_t *prog_handler) {
+    inst_error_t *error;
+
+    error = new_class(prog_handler, BOOLEAN_CLS_NAME, OBJECT_CLS_NAME, false, sizeof(bool));
+    if (error != NULL) return error;
+
+    // Booleans may be used as immediates
+    cls_boolean_t *bool_class;
+    error = get_class(prog_handler, &bool_class, BOOLEAN_CLS_NAME);
+    if (error != NULL) return error;
+    error = set_imm_class(prog_handler, bool_class, IMM_BOOLEAN);
+    return error;
+}
+
+inst_error_t *new_boolean(prog_hand_t *prog_handler, inst_boolean_t *dest, bool value) {
+    return new_immediate(prog_handler, dest, IMM_BOOLEAN, &value);
+}
+
+inst_error_t *init_boolean_cls(prog_hand_t *prog_handler) {
+    inst_error_t *error;
+
+    // Classes
+    cls_boolean_t *bool_class;
+
+    // Get Boolean class
+    error = get_class(prog_handler, &bool_class, BOOLEAN_CLS_NAME);
+    if (error != NULL) return error;
+
+    // Initialise class
+    error = init_class(prog_handler, bool_class);
+    if (error != NULL) return error;
+
+    // Add relevant functions
+    error = add_constructor(prog_handler, bool_class);
+    if (error != NULL) return error;
+    error = add_operator(prog_handler, bool_class, "and", logical_and, 1);
+    if (error != NULL) return error;
+    error = add_operator(prog_handler, bool_class, "or", logical_or, 1);
+    if (error != NULL) return error;
+    error = add_operator(prog_handler, bool_class, "not", logical_not, 0);
+    return error;
+}
+
+static inst_error_t *add_constructor(prog_hand_t *prog_handler, cls_boolean_t *bool_class) {
+    inst_error_t *error;
+    function_t *new_func;
+
+    new_func = (function_t *)malloc(sizeof(function_t));
+    if (new_func == NULL) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+
+    error = new_function(prog_handler, new_func, BOOLEAN_CLS_NAME, constructor, bool_class, NULL,
+                         0);
+    if (error != NULL) return error;
+    error = add_function(prog_handler, bool_class, new_func);
+    return error;
+}
+
+/*
+Adds a Function that changes the value of a Boolean using up to one other Boolean
+
+*prog_handler: The program handler that contains the class and error handlers
+*bool_class: The Boolean class
+*name: The name of the Function
+*operator: The Function that changes the value
+param_count: The number of Boolean parameters of the Function - Either 0 or 1
+*/
+static inst_error_t *add_operator(prog_hand_t *prog_handler, cls_boolean_t *bool_class,
+        char *name, inst_error_t *(*operator)(prog_hand_t *, var_t *, var_t *, var_t **),
+        int param_count) {
+    inst_error_t *error;
+    function_t *new_func;
+    class_t *param_types[1] = { bool_class };
+
+    new_func = (function_t *)malloc(sizeof(function_t));
+    if (new_func == NULL) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+
+    error = new_function(prog_handler, new_func, name, operator, NULL, param_types, param_count);
+    if (error != NULL) return error;
+    error = add_function(prog_handler, bool_class, new_func);
+    return error;
+}
+
+/*
+Type: Non-static
+
+Constructs a Boolean variable, setting the data value to the default (false)
+
+Parameters: None
+
+Returns:
+Boolean - The constructed Boolean instance
+*/
+static inst_error_t *constructor(prog_hand_t *prog_handler, inst_boolean_t *self,
+        var_t *void_return, var_t **void_params) {
+    bool value = false;
+    return init_var_exact(prog_handler, self, &value);
+}
+
+/*
+Type: Non-static
+
+Sets the Boolean instance to true only if both it and the given Boolean are true
+
+Parameters:
+1. Boolean - The Boolean to combine with the first
+
+Returns: None
+*/
+static inst_error_t *logical_and(prog_hand_t *prog_handler, inst_boolean_t *self,
+        var_t *void_return, inst_boolean_t **params) {
+    inst_error_t *error;
+
+    // Get data
+    bool *self_data, *other_data;
+    error = get_data(prog_handler, self, (void **)&self_data);
+    if (error != NULL) return error;
+    error = get_data(prog_handler, params[0], (void **)&other_data);
+    if (error != NULL) return error;
+
+    *self_data = *self_data && *other_data;
+    return NULL;
+}
+
+/*
+Type: Non-static
+
+Sets the Boolean instance to true if either it or the given Boolean is true
+
+Parameters:
+1. Boolean - The Boolean to combine with the first
+
+Returns: None
+*/
+static inst_error_t *logical_or(prog_hand_t *prog_handler, inst_boolean_t *self,
+        var_t *void_return, inst_boolean_t **params) {
+    inst_error_t *error;
+
+    // Get data
+    bool *self_data, *other_data;
+    error = get_data(prog_handler, self, (void **)&self_data);
+    if (error != NULL) return error;
+    error = get_data(prog_handler, params[0], (void **)&other_data);
+    if (error != NULL) return error;
+
+    *self_data = *self_data || *other_data;
+    return NULL;
+}
+
+/*
+Type: Non-static
+
+Inverts the value of the Boolean instance
+
+Parameters: None
+
+Returns: None
+*/
+static inst_error_t *logical_not(prog_hand_t *prog_handler, inst_boolean_t *self,
+        var_t *void_return, var_t **void_params) {
+    inst_error_t *error;
+
+    // Get data
+    bool *self_data;
+    error = get_data(prog_handler, self, (void **)&self_data);
+    if (error != NULL) return error;
+
+    *self_data = !*self_data;
+    return NULL;
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+/*
+Boolean Type
+By Ciaran Gruber
+
+The Boolean Class is one of the base variable types that hold data in its own data holding. Booleans
+are small enough to be used as immediates so they do not need a description or any memory
+
+Parent Class: Object
+
+File-specific:
+Boolean Type - Header File
+The structures used to manage the Boolean class and instances
+*/
+
+#ifndef TYPE_BOOLEAN
+#define TYPE_BOOLEAN
+
+/* The class name that is used to represent a Boolean */
+#define BOOLEAN_CLS_NAME "Boolean"
+
+#include "../../typedefs.h"
+
+/* A type of variable used to represent a Boolean instance */
+typedef inst_object_t inst_boolean_t;
+/* A type of class used to represent a Boolean class */
+typedef cls_object_t cls_boolean_t;
+
+/*
+Creates a new Boolean class and stores it into the Class Handler within the program. The class is
+given the tag of immediate Booleans
+Note: The parent class must have been created before this class is created
+
+*prog_handler: The program handler that contains the class and error handlers
+
+Parent Class: Object
+
+Errors:
+    ErrOutOfMemory: Thrown if there is not enough memory to create an store the class
+    ErrClassAlreadyExists: Thrown if the class already exists within the program handler
+*/
+inst_error_t *new_boolean_cls(prog_hand_t *prog_handler);
+
+/*
+Creates an immediate Boolean which has no description and does not allocate memory
+
+*prog_handler: The program handler that contains the Boolean class
+*dest: The variable that will become the immediate Boolean
+value: The value of the Boolean
+
+Errors:
+    ErrInvalidParameters: Thrown if 'dest' is set to NULL
+    ErrClassNotDefined: Thrown if the Boolean class has not been created
+*/
+inst_error_t *new_boolean(prog_hand_t *prog_handler, inst_boolean_t *dest, bool value);
+
+/*
+Initialises a Boolean class by creating the relevant functions and variables within the class.
+Note:
+All class dependencies must have been created (not necessarily initialised) and exist within
+the class handler
+
+*prog_handler: The program handler that contains the class and error handlers
+
+Class Dependencies:
+    Boolean
+
+Errors:
+    ErrOutOfMemory: Thrown if there is not enough memory to create the functions and class variables
+    ErrClassNotDefined: Thrown if any required classes do not already exist in the program handler
+*/
+inst_error_t *init_boolean_cls(prog_hand_t *prog_handler);
+
+#endif
\ No newline at end of file
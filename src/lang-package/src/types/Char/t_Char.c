@@ -0,0 +1,177 @@
+/*
+Char Type
+By Ciaran Gruber
+
+The Char Class is one of the base variable types that hold data in its own data holding. Chars are
+small enough to be used as immediates so they do not need a description or any memory
+
+Parent Class: Object
+
+File-specific:
+Char Type - Code File
+The code used to provide for the implementation of a Char type
+*/
+
+#include <ctype.h>
+#include "t_Char.h"
+#include "../type_creator.h"
+#include "../Object/t_Object.h"
+#include "../../program-handlers/error-handler/error_handler.h"
+#include "../../program-handlers/class-handler/class_handler.h"
+#include "../../base-program/variable/variable.h"
+#include "../../base-program/function/function.h"
+
+// Initialisation Functions - Used to initialise the class
+
+static inst_error_t *add_constructor(prog_hand_t *prog_handler, cls_char_t *char_class);
+static inst_error_t *add_converter(prog_hand_t *prog_handler, cls_char_t *char_class,
+        char *name, inst_error_t *(*converter)(prog_hand_t *, var_t *, var_t *, var_t **));
+
+// Non-Static Functions
+
+static inst_error_t *constructor(prog_hand_t *prog_handler, inst_char_t *self,
+        var_t *void_return, var_t **void_params);
+static inst_error_t *to_upper(prog_hand_t *prog_handler, inst_char_t *self,
+        var_t *void_return, var_t **void_params);
+static inst_error_t *to_lower(prog_hand_t *prog_handler, inst_char_t *self,
+        var_t *void_return, var_t **void_params);
+
+inst_error_t *new_char_cls(prog_hand_t *prog_handler) {
+    inst_error_t *error;
+
+    error = new_class(prog_handler, CHAR_CLS_NAME, OBJECT_CLS_NAME, false, sizeof(char));
+    if (error != NULL) return error;
+
+    // Chars may be used as immediates
+    cls_char_t *char_class;
+    error = get_class(prog_handler, &char_class, CHAR_CLS_NAME);
+    if (error != NULL) return error;
+    error = set_imm_class(prog_handler, char_class, IMM_CHAR);
+    return error;
+}
+
+inst_error_t *new_char(prog_hand_t *prog_handler, inst_char_t *dest, char value) {
+    return new_immediate(prog_handler, dest, IMM_CHAR, &value);
+}
+
+inst_error_t *init_char_cls(prog_hand_t *prog_handler) {
+    inst_error_t *error;
+
+    // Classes
+    cls_char_t *char_class;
+
+    // Get Char class
+    error = get_class(prog_handler, &char_class, CHAR_CLS_NAME);
+    if (error != NULL) return error;
+
+    // Initialise class
+    error = init_class(prog_handler, char_class);
+    if (error != NULL) return error;
+
+    // Add relevant functions
+    error = add_constructor(prog_handler, char_class);
+    if (error != NULL) return error;
+    error = add_converter(prog_handler, char_class, "to_upper", to_upper);
+    if (error != NULL) return error;
+    error = add_converter(prog_handler, char_class, "to_lower", to_lower);
+    return error;
+}
+
+static inst_error_t *add_constructor(prog_hand_t *prog_handler, cls_char_t *char_class) {
+    inst_error_t *error;
+    function_t *new_func;
+
+    new_func = (function_t *)malloc(sizeof(function_t));
+    if (new_func == NULL) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+
+    error = new_function(prog_handler, new_func, CHAR_CLS_NAME, constructor, char_class, NULL, 0);
+    if (error != NULL) return error;
+    error = add_function(prog_handler, char_class, new_func);
+    return error;
+}
+
+/*
+Adds a Function without parameters that converts the value of a Char
+
+*prog_handler: The program handler that contains the class and error handlers
+*char_class: The Char class
+*name: The name of the Function
+*converter: The Function that converts the value
+*/
+static inst_error_t *add_converter(prog_hand_t *prog_handler, cls_char_t *char_class,
+        char *name, inst_error_t *(*converter)(prog_hand_t *, var_t *, var_t *, var_t **)) {
+    inst_error_t *error;
+    function_t *new_func;
+
+    new_func = (function_t *)malloc(sizeof(function_t));
+    if (new_func == NULL) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+
+    error = new_function(prog_handler, new_func, name, converter, NULL, NULL, 0);
+    if (error != NULL) return error;
+    error = add_function(prog_handler, char_class, new_func);
+    return error;
+}
+
+/*
+Type: Non-static
+
+Constructs a Char variable, setting the data value to the default ('\0')
+
+Parameters: None
+
+Returns:
+Char - The constructed Char instance
+*/
+static inst_error_t *constructor(prog_hand_t *prog_handler, inst_char_t *self,
+        var_t *void_return, var_t **void_params) {
+    char value = '\0';
+    return init_var_exact(prog_handler, self, &value);
+}
+
+/*
+Type: Non-static
+
+Converts the Char instance to upper case if it is a letter
+
+Parameters: None
+
+Returns: None
+*/
+static inst_error_t *to_upper(prog_hand_t *prog_handler, inst_char_t *self,
+        var_t *void_return, var_t **void_params) {
+    inst_error_t *error;
+
+    // Get data
+    char *self_data;
+    error = get_data(prog_handler, self, (void **)&self_data);
+    if (error != NULL) return error;
+
+    *self_data = (char)toupper((unsigned char)*self_data);
+    return NULL;
+}
+
+/*
+Type: Non-static
+
+Converts the Char instance to lower case if it is a letter
+
+Parameters: None
+
+Returns: None
+*/
+static inst_error_t *to_lower(prog_hand_t *prog_handler, inst_char_t *self,
+        var_t *void_return, var_t **void_params) {
+    inst_error_t *error;
+
+    // Get data
+    char *self_data;
+    error = get_data(prog_handler, self, (void **)&self_data);
+    if (error != NULL) return error;
+
+    *self_data = (char)tolower((unsigned char)*self_data);
+    return NULL;
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+/*
+Char Type
+By Ciaran Gruber
+
+The Char Class is one of the base variable types that hold data in its own data holding. Chars are
+small enough to be used as immediates so they do not need a description or any memory
+
+Parent Class: Object
+
+File-specific:
+Char Type - Header File
+The structures used to manage the Char class and instances
+*/
+
+#ifndef TYPE_CHAR
+#define TYPE_CHAR
+
+/* The class name that is used to represent a Char */
+#define CHAR_CLS_NAME "Char"
+
+#include "../../typedefs.h"
+
+/* A type of variable used to represent a Char instance */
+typedef inst_object_t inst_char_t;
+/* A type of class used to represent a Char class */
+typedef cls_object_t cls_char_t;
+
+/*
+Creates a new Char class and stores it into the Class Handler within the program. The class is
+given the tag of immediate Chars
+Note: The parent class must have been created before this class is created
+
+*prog_handler: The program handler that contains the class and error handlers
+
+Parent Class: Object
+
+Errors:
+    ErrOutOfMemory: Thrown if there is not enough memory to create an store the class
+    ErrClassAlreadyExists: Thrown if the class already exists within the program handler
+*/
+inst_error_t *new_char_cls(prog_hand_t *prog_handler);
+
+/*
+Creates an immediate Char which has no description and does not allocate memory
+
+*prog_handler: The program handler that contains the Char class
+*dest: The variable that will become the immediate Char
+value: The value of the Char
+
+Errors:
+    ErrInvalidParameters: Thrown if 'dest' is set to NULL
+    ErrClassNotDefined: Thrown if the Char class has not been created
+*/
+inst_error_t *new_char(prog_hand_t *prog_handler, inst_char_t *dest, char value);
+
+/*
+Initialises a Char class by creating the relevant functions and variables within the class.
+Note:
+All class dependencies must have been created (not necessarily initialised) and exist within
+the class handler
+
+*prog_handler: The program handler that contains the class and error handlers
+
+Class Dependencies:
+    Char
+
+Errors:
+    ErrOutOfMemory: Thrown if there is not enough memory to create the functions and class variables
+    ErrClassNotDefined: Thrown if any required classes do not already exist in the program handler
+*/
+inst_error_t *init_char_cls(prog_hand_t *prog_handler);
+
+#endif
\ No newline at end of file
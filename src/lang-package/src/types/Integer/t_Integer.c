@@ -48,9 +48,20 @@ inst_error_t *new_integer_cls(prog_hand_t *prog_handler) {
 
     error = new_class(prog_handler, INTEGER_CLS_NAME, OBJECT_CLS_NAME, false, 
                         sizeof(int));
+    if (error != NULL) return error;
+
+    // Integers may be used as immediates
+    cls_integer_t *int_class;
+    error = get_class(prog_handler, &int_class, INTEGER_CLS_NAME);
+    if (error != NULL) return error;
+    error = set_imm_class(prog_handler, int_class, IMM_INTEGER);
     return error;
 }
 
+inst_error_t *new_integer(prog_hand_t *prog_handler, inst_integer_t *dest, int value) {
+    return new_immediate(prog_handler, dest, IMM_INTEGER, &value);
+}
+
 inst_error_t *init_integer_cls(prog_hand_t *prog_handler) {
     inst_error_t *error;
 
@@ -76,6 +87,7 @@ inst_error_t *init_integer_cls(prog_hand_t *prog_handler) {
     if (error != NULL) return error;
     error = add_divide(prog_handler, int_class);
     if (error != NULL) return error;
+    return NULL;
 }
 
 static inst_error_t *add_constructor(prog_hand_t *prog_handler, cls_integer_t *int_class) {
@@ -101,7 +113,8 @@ static inst_error_t *add_constructor(prog_hand_t *prog_handler, cls_integer_t *i
 static inst_error_t *add_add(prog_hand_t *prog_handler, cls_integer_t *int_class) {
     inst_error_t *error;
     function_t *new_func;
-    class_t **param_types;
+    // The parameter types are copied by new_function so they are kept on the stack
+    class_t *param_types[1];
     int param_count = 1;
     
     new_func = (function_t *)malloc(sizeof(function_t));
@@ -109,23 +122,19 @@ static inst_error_t *add_add(prog_hand_t *prog_handler, cls_integer_t *int_class
         return new_error(prog_handler, "ErrOutOfMemory");
     }
 
-    param_types = (class_t **)malloc(param_count*sizeof(class_t *));
-    if (param_types == NULL) {
-        return new_error(prog_handler, "ErrOutOfMemory");
-    }
     param_types[0] = int_class;
 
     error = new_function(prog_handler, new_func, "add", add, int_class, 
                             param_types, param_count);
     if (error != NULL) return error;
     error = add_function(prog_handler, int_class, new_func);
-    if (error != NULL) return error;
+    return error;
 }
 
 static inst_error_t *add_subtract(prog_hand_t *prog_handler, cls_integer_t *int_class) {
     inst_error_t *error;
     function_t *new_func;
-    class_t **param_types;
+    class_t *param_types[1];
     int param_count = 1;
     
     new_func = (function_t *)malloc(sizeof(function_t));
@@ -133,23 +142,19 @@ static inst_error_t *add_subtract(prog_hand_t *prog_handler, cls_integer_t *int_
         return new_error(prog_handler, "ErrOutOfMemory");
     }
 
-    param_types = (class_t **)malloc(param_count*sizeof(class_t *));
-    if (param_types == NULL) {
-        return new_error(prog_handler, "ErrOutOfMemory");
-    }
     param_types[0] = int_class;
 
     error = new_function(prog_handler, new_func, "subtract", subtract, int_class, 
                             param_types, param_count);
     if (error != NULL) return error;
     error = add_function(prog_handler, int_class, new_func);
-    if (error != NULL) return error;
+    return error;
 }
 
 static inst_error_t *add_multiply(prog_hand_t *prog_handler, cls_integer_t *int_class) {
     inst_error_t *error;
     function_t *new_func;
-    class_t **param_types;
+    class_t *param_types[1];
     int param_count = 1;
     
     new_func = (function_t *)malloc(sizeof(function_t));
@@ -157,23 +162,19 @@ static inst_error_t *add_multiply(prog_hand_t *prog_handler, cls_integer_t *int_
         return new_error(prog_handler, "ErrOutOfMemory");
     }
 
-    param_types = (class_t **)malloc(param_count*sizeof(class_t *));
-    if (param_types == NULL) {
-        return new_error(prog_handler, "ErrOutOfMemory");
-    }
     param_types[0] = int_class;
 
     error = new_function(prog_handler, new_func, "multiply", multiply, int_class, 
                             param_types, param_count);
     if (error != NULL) return error;
     error = add_function(prog_handler, int_class, new_func);
-    if (error != NULL) return error;
+    return error;
 }
 
 static inst_error_t *add_divide(prog_hand_t *prog_handler, cls_integer_t *int_class) {
     inst_error_t *error;
     function_t *new_func;
-    class_t **param_types;
+    class_t *param_types[1];
     int param_count = 1;
     
     new_func = (function_t *)malloc(sizeof(function_t));
@@ -181,17 +182,13 @@ static inst_error_t *add_divide(prog_hand_t *prog_handler, cls_integer_t *int_cl
         return new_error(prog_handler, "ErrOutOfMemory");
     }
 
-    param_types = (class_t **)malloc(param_count*sizeof(class_t *));
-    if (param_types == NULL) {
-        return new_error(prog_handler, "ErrOutOfMemory");
-    }
     param_types[0] = int_class;
 
     error = new_function(prog_handler, new_func, "divide", divide, int_class, 
                             param_types, param_count);
     if (error != NULL) return error;
     error = add_function(prog_handler, int_class, new_func);
-    if (error != NULL) return error;
+    return error;
 }
 
 /*
@@ -206,7 +203,9 @@ Integer - The constructed Integer instance
 */
 static inst_error_t *constructor(prog_hand_t *prog_handler, inst_integer_t *self,
         var_t *void_return, var_t **void_params) {
-    self->data = (void *)0;
+    // An int fits within the variable so constructing it does not allocate
+    int value = 0;
+    return init_var_exact(prog_handler, self, &value);
 }
 
 /*
@@ -230,12 +229,14 @@ static inst_error_t *add(prog_hand_t *prog_handler, inst_integer_t *self,
     if (error != NULL) return error;
 
     // Get data
-    int self_data, other_data;
-    get_data(prog_handler, self, (void **)&self_data);
-    get_data(prog_handler, other, (void **)&other_data);
+    int *self_data, *other_data;
+    error = get_data(prog_handler, self, (void **)&self_data);
+    if (error != NULL) return error;
+    error = get_data(prog_handler, other, (void **)&other_data);
+    if (error != NULL) return error;
 
     // Add the two values
-    self_data += other_data;
+    *self_data += *other_data;
 
     return NULL;
 }
@@ -261,12 +262,14 @@ static inst_error_t *subtract(prog_hand_t *prog_handler, inst_integer_t *self,
     if (error != NULL) return error;
 
     // Get data
-    int self_data, other_data;
-    get_data(prog_handler, self, (void **)&self_data);
-    get_data(prog_handler, other, (void **)&other_data);
+    int *self_data, *other_data;
+    error = get_data(prog_handler, self, (void **)&self_data);
+    if (error != NULL) return error;
+    error = get_data(prog_handler, other, (void **)&other_data);
+    if (error != NULL) return error;
 
     // Subtract the two values
-    self_data -= other_data;
+    *self_data -= *other_data;
 
     return NULL;
 }
@@ -292,12 +295,14 @@ static inst_error_t *multiply(prog_hand_t *prog_handler, inst_integer_t *self,
     if (error != NULL) return error;
 
     // Get data
-    int self_data, other_data;
-    get_data(prog_handler, self, (void **)&self_data);
-    get_data(prog_handler, other, (void **)&other_data);
+    int *self_data, *other_data;
+    error = get_data(prog_handler, self, (void **)&self_data);
+    if (error != NULL) return error;
+    error = get_data(prog_handler, other, (void **)&other_data);
+    if (error != NULL) return error;
 
     // Multiply the two values
-    self_data *= other_data;
+    *self_data *= *other_data;
 
     return NULL;
 }
@@ -323,12 +328,14 @@ static inst_error_t *divide(prog_hand_t *prog_handler, inst_integer_t *self,
     if (error != NULL) return error;
 
     // Get data
-    int self_data, other_data;
-    get_data(prog_handler, self, (void **)&self_data);
-    get_data(prog_handler, other, (void **)&other_data);
+    int *self_data, *other_data;
+    error = get_data(prog_handler, self, (void **)&self_data);
+    if (error != NULL) return error;
+    error = get_data(prog_handler, other, (void **)&other_data);
+    if (error != NULL) return error;
 
     // Divide the two values
-    self_data /= other_data;
+    *self_data /= *other_data;
 
     return NULL;
 }
\ No newline at end of file
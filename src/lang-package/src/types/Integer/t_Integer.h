@@ -26,7 +26,8 @@ typedef inst_object_t inst_integer_t;
 typedef cls_object_t cls_integer_t;
 
 /*
-Creates a new Integer class and stores it into the Class Handler within the program
+Creates a new Integer class and stores it into the Class Handler within the program. The class is
+given the tag of immediate Integers
 Note: The parent class must have been created before this class is created
 
 *prog_handler: The program handler that contains the class and error handlers
@@ -39,6 +40,19 @@ Errors:
 */
 inst_error_t *new_integer_cls(prog_hand_t *prog_handler);
 
+/*
+Creates an immediate Integer which has no description and does not allocate memory
+
+*prog_handler: The program handler that contains the Integer class
+*dest: The variable that will become the immediate Integer
+value: The value of the Integer
+
+Errors:
+    ErrInvalidParameters: Thrown if 'dest' is set to NULL
+    ErrClassNotDefined: Thrown if the Integer class has not been created
+*/
+inst_error_t *new_integer(prog_hand_t *prog_handler, inst_integer_t *dest, int value);
+
 /*
 Initialises an Integer class by creating the relevant functions and variables within the class. 
 Note:
@@ -21,7 +21,10 @@ The code used to provide for the implementation of a Object type
 #include "../../program-handlers/error-handler/error_handler.h"
 #include "../../program-handlers/class-handler/class_handler.h"
 #include "../../program-handlers/variable-handler/variable_handler.h"
+#include "../../program-handlers/variable-pool/var_pool.h"
+#include "../../program-handlers/region/region.h"
 #include "../../base-program/variable/variable.h"
+#include "../../base-program/variable/var_description.h"
 #include "../../base-program/function/function.h"
 
 // Initialisation Functions - Used to initialise the class
@@ -33,6 +36,12 @@ static inst_error_t *add_str_len(prog_hand_t *prog_handler, cls_object_t *object
         cls_integer_t *int_class);
 static inst_error_t *add_new_copy_vals(prog_hand_t *prog_handler, cls_object_t *object_class);
 
+// Instance Functions - Used to construct the member fields of instances
+
+static inst_error_t *build_prototype(prog_hand_t *prog_handler, class_t *class);
+static inst_error_t *copy_fields(prog_hand_t *prog_handler, inst_fields_t *dest,
+        inst_fields_t *src);
+
 // Non-Static Functions
 
 static inst_error_t *to_string(prog_hand_t *prog_handler, inst_object_t *object,
@@ -174,44 +183,154 @@ inst_error_t *init_object_inst(prog_hand_t *prog_handler, inst_object_t *object,
 
     // Free data if it is already initialised
     if (object->initialised) {
-        if (class->has_managed_data) {
-            free_var_hand(object->data);
-        } else {
-            free(object->data);
-        }
+        free_var_data(object);
     }
 
-    // Do not initialise data if the class does not use the variable handler in its instances
+    // Do not initialise data if the class does not use managed data in its instances
     if (class->has_managed_data == false) {
         return NULL;
     }
 
-    // Set up new variable handler
-    var_hand_t *var_handler = (var_hand_t *)malloc(sizeof(var_hand_t));
-    object->data = var_handler;
-
-    // Add member fields to instance
-    while (class != NULL) {
-        var_desc_hand_node_t *node = class->mem_fields->first;
-        // Loop through member fields in each class
-        while (node != NULL) {
-            var_desc_t *node_data = node->var_desc;
-            var_t *new_variable = (var_t *)malloc(sizeof(var_t));
-
-            // Set variable description
-            error = set_var_desc(prog_handler, new_variable, node_data->type->class_name, 
-                                    node_data->name);
-            if (error != NULL) return error;
+    // The field layout is built when the class is linked
+    if (!class->is_linked) {
+        error = link_class(prog_handler, class);
+        if (error != NULL) return error;
+    }
+    if (class->field_count == 0) {
+        object->data = NULL;
+        return NULL;
+    }
 
-            // Initialise variable
-            error = init_var(prog_handler, new_variable, NULL, 0);
-            if (error != NULL) return error;
+    // Store every member field in a single block copied from the prototype of the class
+    inst_fields_t *fields = (inst_fields_t *)pool_alloc(prog_handler, sizeof(inst_fields_t) +
+                                                        class->field_count*sizeof(var_t));
+    if (fields == NULL) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+    object->data = fields;
+    return copy_prototype(prog_handler, class, fields);
+}
+
+inst_error_t *copy_prototype(prog_hand_t *prog_handler, class_t *class, inst_fields_t *fields) {
+    inst_error_t *error;
+
+    fields->field_count = 0;
+    if (class->prototype == NULL) {
+        error = build_prototype(prog_handler, class);
+        if (error != NULL) return error;
+    }
+    // Blocks within a region are recorded so that their descriptions are released when it ends
+    if (in_region(prog_handler)) {
+        error = region_add_fields(prog_handler, fields);
+        if (error != NULL) return error;
+    }
+    return copy_fields(prog_handler, fields, class->prototype);
+}
+
+/*
+Builds the prototype of a class by constructing each of its member fields. The prototype is never
+allocated within a region as it is kept until the class is linked again
+
+*prog_handler: The program handler that contains the class and error handlers
+*class: The linked class to build the prototype of
+*/
+static inst_error_t *build_prototype(prog_hand_t *prog_handler, class_t *class) {
+    inst_error_t *error;
 
-            // Add variable to instance member fields
-            add_var(prog_handler, var_handler, new_variable);
-            node = node->next;
+    region_mark_t *top = region_pause(prog_handler);
+    inst_fields_t *prototype = (inst_fields_t *)pool_alloc(prog_handler, sizeof(inst_fields_t) +
+                                                           class->field_count*sizeof(var_t));
+    if (prototype == NULL) {
+        region_resume(prog_handler, top);
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+    error = init_object_fields(prog_handler, class, prototype);
+    region_resume(prog_handler, top);
+    if (error != NULL) {
+        free_inst_fields(prototype);
+        return error;
+    }
+    class->prototype = prototype;
+    return NULL;
+}
+
+/*
+Copies a block of member fields into another block of the same size. Member fields whose data is
+stored within the variable are copied as they are and only data held in memory is copied again
+
+*prog_handler: The program handler that contains the Variable Pool
+*dest: The block to copy the member fields into, which may be within a region
+*src: The block of member fields to copy
+*/
+static inst_error_t *copy_fields(prog_hand_t *prog_handler, inst_fields_t *dest,
+        inst_fields_t *src) {
+    inst_error_t *error;
+
+    memcpy(dest->fields, src->fields, src->field_count*sizeof(var_t));
+    for (int i = 0; i < src->field_count; i++) {
+        var_t *field = &(dest->fields[i]);
+        retain_var_desc(field->desc);
+        // Count the member field first so that it is freed if copying its data fails
+        dest->field_count++;
+        if (field->inline_data || field->data == NULL) continue;
+
+        void *data = field->data;
+        field->data = NULL;
+        class_t *class = field->desc->type;
+        if (class->has_managed_data) {
+            inst_fields_t *block = (inst_fields_t *)data;
+            inst_fields_t *copy = (inst_fields_t *)pool_alloc(prog_handler, sizeof(inst_fields_t) +
+                                                              block->field_count*sizeof(var_t));
+            if (copy == NULL) {
+                return new_error(prog_handler, "ErrOutOfMemory");
+            }
+            copy->field_count = 0;
+            field->data = copy;
+            if (in_region(prog_handler)) {
+                error = region_add_fields(prog_handler, copy);
+                if (error != NULL) return error;
+            }
+            error = copy_fields(prog_handler, copy, block);
+            if (error != NULL) return error;
+        } else {
+            field->data = pool_alloc(prog_handler, class->size);
+            if (field->data == NULL) {
+                return new_error(prog_handler, "ErrOutOfMemory");
+            }
+            memcpy(field->data, data, class->size);
         }
-        class = class->parent;
+    }
+    return NULL;
+}
+
+inst_error_t *init_object_fields(prog_hand_t *prog_handler, class_t *class, inst_fields_t *fields) {
+    inst_error_t *error;
+
+    fields->field_count = 0;
+    // Blocks within a region are recorded so that their descriptions are released when it ends
+    if (in_region(prog_handler)) {
+        error = region_add_fields(prog_handler, fields);
+        if (error != NULL) return error;
+    }
+
+    for (int i = 0; i < class->field_count; i++) {
+        var_t *field = &(fields->fields[i]);
+        // Every instance shares the description from the field layout instead of copying it
+        field->desc = class->field_layout[i];
+        retain_var_desc(field->desc);
+        field->data = NULL;
+        field->initialised = false;
+        field->pooled = false;
+        field->embedded = true;
+        field->inline_data = false;
+        field->gc_flags = 0;
+        field->imm_tag = IMM_NONE;
+        atomic_init(&(field->ref_count), 1);
+        // Count the member field first so that it is freed if initialising it fails
+        fields->field_count++;
+
+        error = init_var(prog_handler, field, NULL, 0);
+        if (error != NULL) return error;
     }
 
     return NULL;
@@ -231,7 +350,7 @@ static inst_error_t *new_copy_vals(prog_hand_t *prog_handler, inst_object_t *sel
     
     inst_object_t *other = params[0];
 
-    if (self->desc->type != other->desc->type) {
+    if (var_type(prog_handler, self) != var_type(prog_handler, other)) {
         return new_error(prog_handler, "ErrIncompatibleTypes");
     }
 }
@@ -249,10 +368,15 @@ static inst_error_t *to_string(prog_hand_t *prog_handler, inst_object_t *self,
         inst_string_t *return_var, var_t **params) {
     inst_error_t *error;
 
-    // Set up return variable
-    inst_integer_t *length = (inst_integer_t *)malloc(sizeof(inst_integer_t));
-    new_var(prog_handler, length);
-    error = run_function(prog_handler, self, "str_len", length, NULL, 0);
+    // The length is only needed while converting so it is discarded with the region
+    error = region_begin(prog_handler);
+    if (error != NULL) return error;
+    inst_integer_t *length;
+    error = new_pooled_var(prog_handler, &length);
+    if (error == NULL) {
+        error = run_function(prog_handler, self, "str_len", length, NULL, 0);
+    }
+    region_end(prog_handler);
     if (error != NULL) return error;
     set_var_desc(prog_handler, return_var, STRING_CLASS_NAME, return_var->desc->name);
     init_var(prog_handler, return_var, NULL, 0); // NEEDS TO PRODUCE A STRING ############################
@@ -55,7 +55,8 @@ inst_error_t *init_object_cls(prog_hand_t *prog_handler);
 /*
 Type: Non-Static
 
-Constructs an Object by setting each of its member fields to NULL
+Constructs an Object by storing each of its member fields in a single block, in the slots given by
+the field layout of its class, and initialising each of them
 
 Parameters: None
 
@@ -64,4 +65,35 @@ Returns: None
 inst_error_t *init_object_inst(prog_hand_t *prog_handler, inst_object_t *object,
                                 var_t *void_return, var_t **void_params);
 
+/*
+Initialises each member field of an instance within a block that has already been allocated, using
+the slots given by the field layout of the class. Blocks within a region are recorded so that the
+descriptions of their member fields are released when the region ends
+Note: The class must have been linked
+
+*prog_handler: The program handler that contains the class and error handlers
+*class: The class of the instance
+*fields: The block with enough space for every member field in the field layout of the class
+
+Errors:
+    ErrOutOfMemory: Thrown if there is not enough memory to initialise the member fields
+*/
+inst_error_t *init_object_fields(prog_hand_t *prog_handler, class_t *class, inst_fields_t *fields);
+
+/*
+Initialises each member field of an instance within a block that has already been allocated by
+copying the prototype of the class, which holds the member fields of a default constructed instance.
+Only member fields with data held in memory are copied individually. The prototype is built the
+first time it is needed after the class is linked
+Note: The class must have been linked
+
+*prog_handler: The program handler that contains the class and error handlers
+*class: The class of the instance
+*fields: The block with enough space for every member field in the field layout of the class
+
+Errors:
+    ErrOutOfMemory: Thrown if there is not enough memory to copy the member fields
+*/
+inst_error_t *copy_prototype(prog_hand_t *prog_handler, class_t *class, inst_fields_t *fields);
+
 #endif
\ No newline at end of file
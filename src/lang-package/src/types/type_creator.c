@@ -20,15 +20,34 @@ The code used to provide for the implementation of a String type
 #include "../../src/program-handlers/static-function-handler/static_function_handler.h"
 #include "../../src/program-handlers/variable-description-handler/var_desc_handler.h"
 #include "../../src/program-handlers/variable-handler/variable_handler.h"
+#include "../../src/program-handlers/method-table/method_table.h"
+#include "../../src/program-handlers/static-method-table/static_method_table.h"
+#include "../../src/program-handlers/method-cache/method_cache.h"
+#include "../../src/program-handlers/selector-handler/selector_handler.h"
+#include "../../src/program-handlers/variable-pool/var_pool.h"
+#include "../../src/program-handlers/metadata-arena/meta_arena.h"
+#include "../../src/base-program/function/function_set.h"
+#include "../../src/base-program/static-function/static_function_set.h"
+#include "../../src/base-program/class/class.h"
+#include "../../src/base-program/variable/var_description.h"
+#include "../../src/base-program/variable/variable.h"
+#include "Object/t_Object.h"
 
 static inst_error_t *init_inst_handler(prog_hand_t *prog_handler, class_t *class);
 static inst_error_t *init_static_handler(prog_hand_t *prog_handler, class_t *class);
 static inst_error_t *init_class_variables(prog_hand_t *prog_handler, class_t *class);
 static inst_error_t *init_member_fields(prog_hand_t *prog_handler, class_t *class);
+static inst_error_t *add_own_functions(prog_hand_t *prog_handler, class_t *class,
+        method_table_t *inst_table, s_method_table_t *static_table);
+static inst_error_t *build_field_layout(prog_hand_t *prog_handler, class_t *class,
+        var_desc_t ***layout, int *field_count);
+static inst_error_t *find_constructor(prog_hand_t *prog_handler, class_t *class,
+        method_table_t *inst_table, function_t **dest);
+static void unlink_classes(prog_hand_t *prog_handler);
 
 // The data used in an managed variable and all child classes excluding base classes
 typedef struct {
-    var_hand_t *variable_handler;
+    inst_fields_t *member_fields;
 } managed_data_t;
 
 inst_error_t *new_class(prog_hand_t *prog_handler, char *class_name, char *parent_class,
@@ -37,14 +56,17 @@ inst_error_t *new_class(prog_hand_t *prog_handler, char *class_name, char *paren
     if (class_name == NULL) {
         return new_error(prog_handler, "ErrInvalidParameters");
     }
-    class_t *class = (class_t *)malloc(sizeof(class_t));
+    // Classes last for the whole program so they are held in the Metadata Arena
+    class_t *class = (class_t *)arena_alloc(prog_handler, sizeof(class_t));
+    if (class == NULL) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
 
     // Create class name
-    class->class_name = (char *)malloc(strlen(class_name));
+    class->class_name = arena_copy_str(prog_handler, class_name);
     if (class->class_name == NULL) {
         return new_error(prog_handler, "ErrOutOfMemory");
     }
-    strcpy(class->class_name, class_name);
 
     // Set parent class
     if (parent_class == NULL) {
@@ -54,6 +76,21 @@ inst_error_t *new_class(prog_hand_t *prog_handler, char *class_name, char *paren
         if (error!= NULL) return error;
     }
 
+    // Handlers are created when the class is initialised
+    class->static_methods = NULL;
+    class->inst_methods = NULL;
+    class->class_vars = NULL;
+    class->mem_fields = NULL;
+    class->inst_table = NULL;
+    class->static_table = NULL;
+    class->field_layout = NULL;
+    class->field_count = 0;
+    class->prototype = NULL;
+    class->constructor = NULL;
+    class->trace = NULL;
+    class->is_linked = false;
+    class->link_count = 0;
+
     // Set integer data description
     class->has_managed_data = managed_data;
     if (managed_data) {
@@ -61,8 +98,15 @@ inst_error_t *new_class(prog_hand_t *prog_handler, char *class_name, char *paren
     } else {
         class->size = size;
     }
+    class->imm_tag = IMM_NONE;
+
+    class->error_inst = NULL;
 
     error = add_class(prog_handler, class);
+    if (error != NULL) return error;
+
+    // Preallocate the instance thrown for Error classes
+    error = prealloc_error(prog_handler, class);
     return error;
 }
 
@@ -92,6 +136,132 @@ inst_error_t *init_class(prog_hand_t *prog_handler, class_t *class) {
         class->mem_fields = NULL;
     }
 
+    class->is_linked = false;
+    return NULL;
+}
+
+inst_error_t *set_imm_class(prog_hand_t *prog_handler, class_t *class, int tag) {
+    if (class == NULL || tag <= IMM_NONE || tag >= IMM_TAG_COUNT) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+    // The data of an immediate is always stored within the variable
+    if (class->has_managed_data || class->size > MAX_INLINE_DATA) {
+        return new_error(prog_handler, "ErrInvalidDataFormat");
+    }
+
+    // Untag the class previously given the tag
+    if (prog_handler->imm_classes[tag] != NULL) {
+        prog_handler->imm_classes[tag]->imm_tag = IMM_NONE;
+    }
+    prog_handler->imm_classes[tag] = class;
+    class->imm_tag = tag;
+    return NULL;
+}
+
+inst_error_t *set_trace_hook(prog_hand_t *prog_handler, class_t *class,
+        inst_error_t *(*trace)(prog_hand_t *, var_t *)) {
+    if (class == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+    // The member fields of managed data are always traced by the collector
+    if (class->has_managed_data) {
+        return new_error(prog_handler, "ErrInvalidDataFormat");
+    }
+
+    class->trace = trace;
+    return NULL;
+}
+
+inst_error_t *link_class(prog_hand_t *prog_handler, class_t *class) {
+    inst_error_t *error;
+    if (class == NULL) {
+        return new_error(prog_handler, "ErrInvalidParameters");
+    }
+    if (class->is_linked) return NULL;
+
+    // Functions are only inherited through parents with managed data and otherwise from Object
+    class_t *base = class->parent;
+    if (base != NULL && !base->has_managed_data) {
+        bool object_exists;
+        error = class_exists(prog_handler, &object_exists, &base, OBJECT_CLS_NAME);
+        if (error != NULL) return error;
+    }
+    if (base == class) {
+        base = NULL;
+    }
+    // Link the inherited class first so that its tables are complete
+    if (base != NULL) {
+        error = link_class(prog_handler, base);
+        if (error != NULL) return error;
+    }
+
+    // Create tables
+    method_table_t *inst_table = (method_table_t *)malloc(sizeof(method_table_t));
+    s_method_table_t *static_table = (s_method_table_t *)malloc(sizeof(s_method_table_t));
+    if (inst_table == NULL || static_table == NULL) {
+        free(inst_table);
+        free(static_table);
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+    new_mtable(prog_handler, inst_table);
+    new_smtable(prog_handler, static_table);
+
+    // Inherit functions and then add the class' own functions to override them
+    error = NULL;
+    if (base != NULL) {
+        error = mtable_inherit(prog_handler, inst_table, base->inst_table);
+        if (error == NULL) {
+            error = smtable_inherit(prog_handler, static_table, base->static_table);
+        }
+    }
+    if (error == NULL) {
+        error = add_own_functions(prog_handler, class, inst_table, static_table);
+    }
+    var_desc_t **field_layout = NULL;
+    int field_count = 0;
+    if (error == NULL) {
+        error = build_field_layout(prog_handler, class, &field_layout, &field_count);
+    }
+    function_t *constructor = NULL;
+    if (error == NULL) {
+        error = find_constructor(prog_handler, class, inst_table, &constructor);
+    }
+    if (error != NULL) {
+        free_mtable(inst_table);
+        free_smtable(static_table);
+        free_field_layout(field_layout, field_count);
+        return error;
+    }
+
+    // Replace any outdated tables and layout. The prototype may be outdated by any change to the
+    // classes of its member fields so it is built again when it is next needed
+    free_mtable(class->inst_table);
+    free_smtable(class->static_table);
+    free_field_layout(class->field_layout, class->field_count);
+    free_inst_fields(class->prototype);
+    class->prototype = NULL;
+    class->inst_table = inst_table;
+    class->static_table = static_table;
+    class->field_layout = field_layout;
+    class->field_count = field_count;
+    class->constructor = constructor;
+    class->is_linked = true;
+    class->link_count++;
+    return NULL;
+}
+
+inst_error_t *link_classes(prog_hand_t *prog_handler) {
+    inst_error_t *error;
+
+    // Number classes so that subclasses can be checked without walking the class tree
+    error = number_classes(prog_handler);
+    if (error != NULL) return error;
+
+    cls_hand_t *cls_handler = prog_handler->cls_handler;
+    for (int i = 0; i < cls_handler->class_count; i++) {
+        error = link_class(prog_handler, cls_handler->classes[i]);
+        if (error != NULL) return error;
+    }
     return NULL;
 }
 
@@ -102,7 +272,11 @@ inst_error_t *add_function(prog_hand_t *prog_handler, class_t *class, function_t
     }
 
     error = fhand_add_function(prog_handler, class->inst_methods, function);
-    return error;
+    if (error != NULL) return error;
+
+    // Child classes may inherit the function so every class must be relinked
+    unlink_classes(prog_handler);
+    return NULL;
 }
 
 inst_error_t *remove_function(prog_hand_t *prog_handler, class_t *class, function_t *function) {
@@ -113,7 +287,11 @@ inst_error_t *remove_function(prog_hand_t *prog_handler, class_t *class, functio
 
     error = fhand_remove_function(prog_handler, class->inst_methods, function->name, 
                                     function->param_types, function->param_count);
-    return error;
+    if (error != NULL) return error;
+
+    // Child classes may inherit the function so every class must be relinked
+    unlink_classes(prog_handler);
+    return NULL;
 }
 
 inst_error_t *remove_function_by_name(prog_hand_t *prog_handler, class_t *class, char *name,
@@ -125,7 +303,11 @@ inst_error_t *remove_function_by_name(prog_hand_t *prog_handler, class_t *class,
 
     error = fhand_remove_function(prog_handler, class->inst_methods, name, param_types,
                                             param_count);
-    return error;
+    if (error != NULL) return error;
+
+    // Child classes may inherit the function so every class must be relinked
+    unlink_classes(prog_handler);
+    return NULL;
 }
 
 inst_error_t *add_s_function(prog_hand_t *prog_handler, class_t *class, s_function_t *function) {
@@ -135,7 +317,11 @@ inst_error_t *add_s_function(prog_hand_t *prog_handler, class_t *class, s_functi
     }
 
     error = sfhand_add_function(prog_handler, class->static_methods, function);
-    return error;
+    if (error != NULL) return error;
+
+    // Child classes may inherit the function so every class must be relinked
+    unlink_classes(prog_handler);
+    return NULL;
 }
 
 inst_error_t *remove_s_function(prog_hand_t *prog_handler, class_t *class, s_function_t *function) {
@@ -146,7 +332,11 @@ inst_error_t *remove_s_function(prog_hand_t *prog_handler, class_t *class, s_fun
 
     error = sfhand_remove_function(prog_handler, class->static_methods, function->name,
                                     function->param_types, function->param_count);
-    return error;
+    if (error != NULL) return error;
+
+    // Child classes may inherit the function so every class must be relinked
+    unlink_classes(prog_handler);
+    return NULL;
 }
 
 inst_error_t *remove_s_function_by_name(prog_hand_t *prog_handler, class_t *class, char *name,
@@ -158,7 +348,11 @@ inst_error_t *remove_s_function_by_name(prog_hand_t *prog_handler, class_t *clas
 
     error = sfhand_remove_function(prog_handler, class->static_methods, name, param_types,
                                         param_count);
-    return error;
+    if (error != NULL) return error;
+
+    // Child classes may inherit the function so every class must be relinked
+    unlink_classes(prog_handler);
+    return NULL;
 }
 
 inst_error_t *add_member_field(prog_hand_t *prog_handler, class_t *class, char *name,
@@ -168,21 +362,33 @@ inst_error_t *add_member_field(prog_hand_t *prog_handler, class_t *class, char *
         return new_error(prog_handler, "ErrInvalidParameters");
     }
 
-    // Create member field
-    var_desc_t *new_field = (var_desc_t *)malloc(sizeof(var_desc_t));
+    // Create member field using an interned name as it is shared by every instance of the class
+    int selector;
+    char *interned_name;
+    error = get_selector(prog_handler, &selector, name);
+    if (error != NULL) return error;
+    error = get_selector_name(prog_handler, &interned_name, selector);
+    if (error != NULL) return error;
+    var_desc_t *new_field = (var_desc_t *)pool_alloc(prog_handler, sizeof(var_desc_t));
     if (new_field == NULL) {
         return new_error(prog_handler, "ErrOutOfMemory");
     }
-    new_field->name = (char *)malloc(strlen(name)*sizeof(char));
-    if (new_field->name == NULL) {
-        return new_error(prog_handler, "ErrOutOfMemory");
-    }
-    strcpy(new_field->name, name);
+    new_field->name = interned_name;
+    new_field->owns_name = false;
     new_field->type = type;
+    new_field->initialised = true;
+    atomic_init(&(new_field->ref_count), 1);
 
     // Add member field
     error = add_var_desc(prog_handler, class->mem_fields, new_field);
-    return error;
+    if (error != NULL) {
+        free_var_desc(new_field);
+        return error;
+    }
+
+    // Subclasses inherit the member field so every field layout must be rebuilt
+    unlink_classes(prog_handler);
+    return NULL;
 }
 
 inst_error_t *remove_member_field(prog_hand_t *prog_handler, class_t *class, char *name) {
@@ -192,6 +398,11 @@ inst_error_t *remove_member_field(prog_hand_t *prog_handler, class_t *class, cha
     }
 
     error = remove_var_desc_by_name(prog_handler, class->mem_fields, name);
+    if (error != NULL) return error;
+
+    // Subclasses inherit the member field so every field layout must be rebuilt
+    unlink_classes(prog_handler);
+    return NULL;
 }
 
 inst_error_t *add_class_var(prog_hand_t *prog_handler, class_t *class, var_t *class_var) {
@@ -212,6 +423,7 @@ inst_error_t *remove_class_var(prog_hand_t *prog_handler, class_t *class, char *
     }
 
     error = remove_var_by_name(prog_handler, class->class_vars, name);
+    return error;
 }
 
 /*
@@ -227,7 +439,7 @@ static inst_error_t *init_inst_handler(prog_hand_t *prog_handler, class_t *class
     inst_error_t *error;
 
     // Allocate methods
-    funct_hand_t *inst_methods = (funct_hand_t *)malloc(sizeof(funct_hand_t));
+    funct_hand_t *inst_methods = (funct_hand_t *)arena_alloc(prog_handler, sizeof(funct_hand_t));
     if (inst_methods == NULL) {
         return new_error(prog_handler, "ErrOutOfMemory");
     }
@@ -251,7 +463,8 @@ Errors:
 static inst_error_t *init_static_handler(prog_hand_t *prog_handler, class_t *class) {
     inst_error_t *error;
 
-    s_funct_hand_t *static_methods = (s_funct_hand_t *)malloc(sizeof(s_funct_hand_t));
+    s_funct_hand_t *static_methods = (s_funct_hand_t *)arena_alloc(prog_handler,
+                                                                   sizeof(s_funct_hand_t));
     if (static_methods == NULL) {
         return new_error(prog_handler, "ErrOutOfMemory");
     }
@@ -305,4 +518,158 @@ static inst_error_t *init_member_fields(prog_hand_t *prog_handler, class_t *clas
     class->mem_fields = member_fields;
 
     return NULL;
-}
\ No newline at end of file
+}
+/*
+Adds the functions defined by a class to its method tables, overriding any inherited functions with
+the same parameters
+
+*prog_handler: The program handler that contains the class and error handlers
+*class: The class whose functions are to be added
+*inst_table: The table to add the Non-Static Functions to
+*static_table: The table to add the Static Functions to
+
+Errors:
+    ErrOutOfMemory: Thrown if there is not enough memory to add the functions
+*/
+static inst_error_t *add_own_functions(prog_hand_t *prog_handler, class_t *class,
+        method_table_t *inst_table, s_method_table_t *static_table) {
+    inst_error_t *error;
+
+    // Add Non-Static Functions
+    if (class->inst_methods != NULL) {
+        funct_hand_node_t *set_node = class->inst_methods->first;
+        while (set_node != NULL) {
+            funct_node_t *node = set_node->function_set->first;
+            while (node != NULL) {
+                error = mtable_add_function(prog_handler, inst_table, node->function);
+                if (error != NULL) return error;
+                node = node->next;
+            }
+            set_node = set_node->next;
+        }
+    }
+
+    // Add Static Functions
+    if (class->static_methods != NULL) {
+        s_funct_hand_node_t *set_node = class->static_methods->first;
+        while (set_node != NULL) {
+            s_funct_node_t *node = set_node->function_set->first;
+            while (node != NULL) {
+                error = smtable_add_function(prog_handler, static_table, node->function);
+                if (error != NULL) return error;
+                node = node->next;
+            }
+            set_node = set_node->next;
+        }
+    }
+    return NULL;
+}
+
+/*
+Builds the field layout of a class by placing the member fields of its parent first, in the same
+slots as they have in the parent, followed by the member fields of the class itself. The parent
+must already be linked
+
+*prog_handler: The program handler that contains the class and error handlers
+*class: The class whose field layout is to be built
+***layout: The location to store the field layout into - Set to NULL if there are no member fields
+*field_count: The location to store the number of member fields into
+
+Errors:
+    ErrOutOfMemory: Thrown if there is not enough memory to create the field layout
+    ErrVariableNameTaken: Thrown if a member field has the same name as an inherited member field
+*/
+static inst_error_t *build_field_layout(prog_hand_t *prog_handler, class_t *class,
+        var_desc_t ***layout, int *field_count) {
+    *layout = NULL;
+    *field_count = 0;
+    if (!class->has_managed_data) return NULL;
+
+    // Member fields are only inherited from parents with managed data
+    int inherited = 0;
+    if (class->parent != NULL && class->parent->has_managed_data) {
+        inherited = class->parent->field_count;
+    }
+    int count = inherited;
+    var_desc_hand_node_t *node = class->mem_fields != NULL ? class->mem_fields->first : NULL;
+    while (node != NULL) {
+        count++;
+        node = node->next;
+    }
+    if (count == 0) return NULL;
+
+    var_desc_t **fields = (var_desc_t **)malloc(count*sizeof(var_desc_t *));
+    if (fields == NULL) {
+        return new_error(prog_handler, "ErrOutOfMemory");
+    }
+    if (inherited > 0) {
+        memcpy(fields, class->parent->field_layout, inherited*sizeof(var_desc_t *));
+    }
+
+    // Add own member fields after the inherited ones
+    int slot = inherited;
+    node = class->mem_fields != NULL ? class->mem_fields->first : NULL;
+    while (node != NULL) {
+        for (int i = 0; i < inherited; i++) {
+            if (!strcmp(fields[i]->name, node->var_desc->name)) {
+                free(fields);
+                return new_error(prog_handler, "ErrVariableNameTaken");
+            }
+        }
+        fields[slot++] = node->var_desc;
+        node = node->next;
+    }
+
+    // The layout keeps each description alive until it is rebuilt, even if a field is removed
+    for (int i = 0; i < count; i++) {
+        retain_var_desc(fields[i]);
+    }
+
+    *layout = fields;
+    *field_count = count;
+    return NULL;
+}
+
+/*
+Finds the constructor of a class that is run without parameters so that constructing an instance
+does not need to look it up
+
+*prog_handler: The program handler that contains the class and error handlers
+*class: The class being linked
+*inst_table: The new Method Table of the class
+**dest: The location to store the constructor into - NULL if the class has none
+*/
+static inst_error_t *find_constructor(prog_hand_t *prog_handler, class_t *class,
+        method_table_t *inst_table, function_t **dest) {
+    inst_error_t *error;
+    *dest = NULL;
+
+    // A constructor can not exist if the class name has never been interned
+    bool found;
+    int selector;
+    error = selector_exists(prog_handler, &found, &selector, class->class_name);
+    if (error != NULL || !found) return error;
+
+    function_t *constructor;
+    error = mtable_try_get_function_sel(prog_handler, inst_table, &found, &constructor, selector,
+                                        NULL, 0);
+    if (error != NULL) return error;
+    if (found) {
+        *dest = constructor;
+    }
+    return NULL;
+}
+
+/*
+Marks every class as unlinked so that their method tables are rebuilt before they are next used and
+invalidates the Method Cache as it may hold Functions that have been overridden or removed
+
+*prog_handler: The program handler that contains the class and error handlers
+*/
+static void unlink_classes(prog_hand_t *prog_handler) {
+    cls_hand_t *cls_handler = prog_handler->cls_handler;
+    for (int i = 0; i < cls_handler->class_count; i++) {
+        cls_handler->classes[i]->is_linked = false;
+    }
+    mcache_invalidate(prog_handler);
+}
@@ -46,6 +46,65 @@ Errors:
 */
 inst_error_t *init_class(prog_hand_t *prog_handler, class_t *class);
 
+/*
+Sets the class whose immediates are given a tag. Immediates have no description and store their data
+within the variable so only classes with unmanaged data no larger than a pointer may be used
+
+*prog_handler: The program handler that contains the class and error handlers
+*class: The class of the immediates
+tag: The tag given to the immediates, such as IMM_INTEGER
+
+Errors:
+    ErrInvalidParameters: Thrown if 'class' is set to NULL or 'tag' is not the tag of an immediate
+    ErrInvalidDataFormat: Thrown if the class uses managed data or its data is larger than a pointer
+*/
+inst_error_t *set_imm_class(prog_hand_t *prog_handler, class_t *class, int tag);
+
+/*
+Sets the hook run by the collector to mark the variables referred to by the unmanaged data of
+instances of a class. The hook calls gc_mark for each variable referred to by the instance it is
+given. Trace hooks are the only way for a tracked variable to keep another alive, as member fields
+are stored within their instance rather than referring to other variables
+
+*prog_handler: The program handler that contains the class and error handlers
+*class: The class whose instances are traced
+*trace: The hook that traces an instance, set to NULL to not trace the unmanaged data
+
+Errors:
+    ErrInvalidParameters: Thrown if 'class' is set to NULL
+    ErrInvalidDataFormat: Thrown if the class uses managed data
+*/
+inst_error_t *set_trace_hook(prog_hand_t *prog_handler, class_t *class,
+        inst_error_t *(*trace)(prog_hand_t *, var_t *));
+
+/*
+Links a class by building the method tables that contain its own functions as well as every function
+it inherits, so that a function can be found without searching each parent class. The field layout
+giving the slot of each member field in instances of the class is built at the same time. Classes
+are linked automatically before they are first used, and are unlinked whenever a function or member
+field is added to or removed from any class
+
+*prog_handler: The program handler that contains the class and error handlers
+*class: The class to link
+
+Errors:
+    ErrInvalidParameters: Thrown if 'class' is set to NULL
+    ErrOutOfMemory: Thrown if there is not enough memory to create the method tables
+    ErrVariableNameTaken: Thrown if a member field has the same name as an inherited member field
+*/
+inst_error_t *link_class(prog_hand_t *prog_handler, class_t *class);
+
+/*
+Links every class within the Class Handler. This should be done once all classes in a package have
+been initialised
+
+*prog_handler: The program handler that contains the class and error handlers
+
+Errors:
+    ErrOutOfMemory: Thrown if there is not enough memory to create the method tables
+*/
+inst_error_t *link_classes(prog_hand_t *prog_handler);
+
 /*
 Attempts to add a function to a class
 
@@ -134,7 +193,8 @@ inst_error_t *remove_s_function_by_name(prog_hand_t *prog_handler, class_t *clas
         class_t **param_types, int param_count);
 
 /*
-Attempts to add a member field to a class
+Attempts to add a member field to a class. Instances created before the member field is added keep
+the member fields they were created with
 
 *prog_handler: The program handler that contains the class and error handlers
 *class: The class to add the member field to
@@ -162,7 +222,8 @@ Errors:
 inst_error_t *remove_member_field(prog_hand_t *prog_handler, class_t *class, char *name);
 
 /*
-Attempts to add a class variable to a class
+Attempts to add a class variable to a class. The class takes over the reference given to it and
+releases it when the class variable is removed or the class is freed
 
 *prog_handler: The program handler that contains the class and error handlers
 *class: The class to add the class variable to
@@ -170,14 +231,15 @@ Attempts to add a class variable to a class
 *type: The type of the class variable that is to be added
 
 Errors:
-    ErrInvalidParameters: Thrown if 'class' or 'class_var' is set to NULL
+    ErrInvalidParameters: Thrown if 'class' or 'class_var' is set to NULL or 'class_var' is an
+                          immediate or tracked by the collector
     ErrOutOfMemory: Thrown if there is not enough memory needed to add the class variable to the class
     ErrVariableNameTaken: Thrown if the given class variable already exists in the class
 */
 inst_error_t *add_class_var(prog_hand_t *prog_handler, class_t *class, var_t *class_var);
 
 /*
-Attempts to remove a class variable from a class
+Attempts to remove a class variable from a class, releasing the reference held by the class
 
 *prog_handler: The program handler that contains the class and error handlers
 *class: The class to remove the class variable from